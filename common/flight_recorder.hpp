@@ -3,9 +3,14 @@
 #include <common/utils.hpp>
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
-#include <iomanip>
-#include <iostream>
+#include <limits>
+#include <span>
 #include <vector>
 
 PHOSPHOR_LOG2_USING;
@@ -15,35 +20,88 @@ namespace pldm
 namespace flightrecorder
 {
 using ReqOrResponse = bool;
-using FlightRecorderData = std::vector<uint8_t>;
-using FlightRecorderTimeStamp = std::string;
-using FlightRecorderRecord =
-    std::tuple<FlightRecorderTimeStamp, ReqOrResponse, FlightRecorderData>;
-using FlightRecorderCassette = std::vector<FlightRecorderRecord>;
 static constexpr auto flightRecorderDumpPath = "/tmp/pldm_flight_recorder";
 
+/** @brief Magic at the start of the flight recorder dump */
+constexpr std::array<char, 8> flightRecorderMagic = {'P', 'L', 'D', 'M',
+                                                     'F', 'R', 'E', 'C'};
+
+/** @brief Version of the flight recorder dump format */
+constexpr uint16_t flightRecorderVersion = 1;
+
+/** @struct FlightRecorderHeader
+ *
+ *  Header of the flight recorder dump, followed by the records from the oldest
+ *  to the newest. The fields are in host byte order.
+ */
+struct __attribute__((packed)) FlightRecorderHeader
+{
+    std::array<char, 8> magic; //!< flightRecorderMagic
+    uint16_t version;          //!< flightRecorderVersion
+    uint16_t payloadSize;      //!< message bytes stored in each record
+    uint32_t numRecords;       //!< number of records in the dump
+    uint64_t monotonicTime;    //!< CLOCK_MONOTONIC at the dump in ns
+    uint64_t realTime;         //!< CLOCK_REALTIME at the dump in ns
+};
+
+/** @struct FlightRecorderRecordHeader
+ *
+ *  Header of a record, followed by payloadSize bytes holding the start of the
+ *  message, zero padded.
+ */
+struct __attribute__((packed)) FlightRecorderRecordHeader
+{
+    uint64_t timestamp; //!< CLOCK_MONOTONIC when recorded in ns
+    uint16_t length;    //!< length of the message, may exceed payloadSize
+    uint8_t eid;        //!< EID of the remote endpoint
+    uint8_t isTx;       //!< 1 for an outgoing message, 0 for an incoming one
+};
+
 /** @class FlightRecorder
  *
  *  The class for implementing the PLDM flight recorder logic. This class
  *  handles the insertion of the data into the recorder and also provides
  *  API's to dump the flight recorder into a file.
+ *
+ *  The records are kept in fixed size slots of a ring allocated once, so that
+ *  recording a message only copies its first bytes and a monotonic timestamp.
+ *  The dump is binary, tools/flight-recorder decodes it offline.
  */
 
 class FlightRecorder
 {
   private:
-    FlightRecorder() : index(0)
+    FlightRecorder() :
+        FlightRecorder(FLIGHT_RECORDER_MAX_ENTRIES,
+                       FLIGHT_RECORDER_PAYLOAD_SIZE)
+    {}
+
+  protected:
+    /** @brief Constructor
+     *
+     *  @param[in] numEntries - number of records kept, 0 disables the
+     *                          recorder
+     *  @param[in] payloadSize - message bytes stored in each record
+     */
+    FlightRecorder(size_t numEntries, size_t payloadSize) :
+        numEntries(numEntries),
+        payloadSize(std::min<size_t>(payloadSize,
+                                     std::numeric_limits<uint16_t>::max())),
+        slotSize(sizeof(FlightRecorderRecordHeader) + this->payloadSize)
     {
-        flightRecorderPolicy = FLIGHT_RECORDER_MAX_ENTRIES ? true : false;
+        flightRecorderPolicy = numEntries ? true : false;
         if (flightRecorderPolicy)
         {
-            tapeRecorder = FlightRecorderCassette(FLIGHT_RECORDER_MAX_ENTRIES);
+            tapeRecorder.resize(numEntries * slotSize);
         }
     }
 
-  protected:
-    int index;
-    FlightRecorderCassette tapeRecorder;
+    size_t index = 0;                 //!< slot of the next record
+    uint64_t numRecorded = 0;         //!< number of records since start
+    size_t numEntries;                //!< number of slots
+    size_t payloadSize;               //!< message bytes stored per slot
+    size_t slotSize;                  //!< size of a slot
+    std::vector<uint8_t> tapeRecorder; //!< the slots
     bool flightRecorderPolicy;
 
   public:
@@ -64,55 +122,79 @@ class FlightRecorder
      *  @param[in] buffer  - The request/response byte buffer
      *  @param[in] isRequest - bool that captures if it is a request message or
      *                         a response message
+     *  @param[in] eid - EID of the remote endpoint
      *
      *  @return void
      */
-    void saveRecord(const FlightRecorderData& buffer, ReqOrResponse isRequest)
+    void saveRecord(std::span<const uint8_t> buffer, ReqOrResponse isRequest,
+                    uint8_t eid)
     {
         // if the flight recorder policy is enabled, then only insert the
         // messages into the flight recorder, if not this function will be just
         // a no-op
         if (flightRecorderPolicy)
         {
-            int currentIndex = index++;
-            tapeRecorder[currentIndex] = std::make_tuple(
-                pldm::utils::getCurrentSystemTime(), isRequest, buffer);
-            index =
-                (currentIndex == FLIGHT_RECORDER_MAX_ENTRIES - 1) ? 0 : index;
+            auto slot = tapeRecorder.data() + index * slotSize;
+            FlightRecorderRecordHeader header{
+                static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count()),
+                static_cast<uint16_t>(std::min<size_t>(
+                    buffer.size(), std::numeric_limits<uint16_t>::max())),
+                eid, isRequest};
+            std::memcpy(slot, &header, sizeof(header));
+
+            auto length = std::min(buffer.size(), payloadSize);
+            auto payload = slot + sizeof(header);
+            std::memcpy(payload, buffer.data(), length);
+            std::memset(payload + length, 0, payloadSize - length);
+
+            index = (index == numEntries - 1) ? 0 : index + 1;
+            numRecorded++;
         }
     }
 
     /** @brief play flight recorder
+     *
+     *  @param[in] path - path of the dump file
      *
      *  @return void
      */
 
-    void playRecorder()
+    void playRecorder(
+        const std::filesystem::path& path = flightRecorderDumpPath) const
     {
         if (flightRecorderPolicy)
         {
-            std::ofstream recorderOutputFile(flightRecorderDumpPath);
+            std::ofstream recorderOutputFile(path, std::ios::binary);
             info("Dumping the flight recorder into : {DUMP_PATH}", "DUMP_PATH",
-                 flightRecorderDumpPath);
-            for (const auto& message : tapeRecorder)
-            {
-                recorderOutputFile
-                    << std::get<FlightRecorderTimeStamp>(message) << " : ";
-                if (std::get<ReqOrResponse>(message))
-                {
-                    recorderOutputFile << "Tx : \n";
-                }
-                else
-                {
-                    recorderOutputFile << "Rx : \n";
-                }
-                for (const auto& word : std::get<FlightRecorderData>(message))
-                {
-                    recorderOutputFile << std::setfill('0') << std::setw(2)
-                                       << std::hex << (unsigned)word << " ";
-                }
-                recorderOutputFile << std::endl;
-            }
+                 path.c_str());
+
+            auto numRecords =
+                static_cast<size_t>(std::min<uint64_t>(numRecorded, numEntries));
+            FlightRecorderHeader header{
+                flightRecorderMagic,
+                flightRecorderVersion,
+                static_cast<uint16_t>(payloadSize),
+                static_cast<uint32_t>(numRecords),
+                static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count()),
+                static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                        .count())};
+            recorderOutputFile.write(reinterpret_cast<const char*>(&header),
+                                     sizeof(header));
+
+            // the oldest record is at index once the ring has wrapped
+            auto oldest = numRecorded > numEntries ? index : 0;
+            auto data = reinterpret_cast<const char*>(tapeRecorder.data());
+            recorderOutputFile.write(data + oldest * slotSize,
+                                     (numRecords - oldest) * slotSize);
+            recorderOutputFile.write(data, oldest * slotSize);
             recorderOutputFile.close();
         }
         else
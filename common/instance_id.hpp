@@ -2,9 +2,11 @@
 
 #include <libpldm/instance-id.h>
 
+#include <array>
 #include <cerrno>
 #include <cstdint>
 #include <exception>
+#include <limits>
 #include <string>
 #include <system_error>
 
@@ -63,6 +65,7 @@ class InstanceIdDb
 
         if (rc == -EAGAIN)
         {
+            exhaustedCounts[tid]++;
             throw std::runtime_error("No free instance ids");
         }
 
@@ -93,8 +96,28 @@ class InstanceIdDb
         }
     }
 
+    /** @brief Get the number of allocations which failed because all the
+     *         instance IDs of the terminus were in use
+     *  @param[in] tid - the terminus ID
+     *  @return - the number of failed allocations
+     */
+    uint32_t getExhaustedCount(uint8_t tid) const
+    {
+        return exhaustedCounts[tid];
+    }
+
+    /** @brief Clear the failed allocation counts of all the termini */
+    void resetExhaustedCounts()
+    {
+        exhaustedCounts.fill(0);
+    }
+
   private:
     pldm_instance_db* pldmInstanceIdDb = nullptr;
+
+    /** @brief Failed allocation counts indexed by terminus ID */
+    std::array<uint32_t, std::numeric_limits<uint8_t>::max() + 1>
+        exhaustedCounts{};
 };
 
 } // namespace pldm
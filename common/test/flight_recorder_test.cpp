@@ -0,0 +1,65 @@
+#include "common/flight_recorder.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::flightrecorder;
+
+class TestFlightRecorder : public FlightRecorder
+{
+  public:
+    TestFlightRecorder(size_t numEntries, size_t payloadSize) :
+        FlightRecorder(numEntries, payloadSize)
+    {}
+};
+
+TEST(FlightRecorder, wrapAndTruncate)
+{
+    TestFlightRecorder recorder(3, 4);
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        std::vector<uint8_t> msg(i + 2, i);
+        recorder.saveRecord(msg, i % 2 == 0, 8 + i);
+    }
+
+    auto path = std::filesystem::temp_directory_path() / "flight_recorder_test";
+    recorder.playRecorder(path);
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> dump((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+    std::filesystem::remove(path);
+
+    constexpr size_t slotSize = sizeof(FlightRecorderRecordHeader) + 4;
+    ASSERT_EQ(dump.size(), sizeof(FlightRecorderHeader) + 3 * slotSize);
+
+    FlightRecorderHeader header{};
+    std::memcpy(&header, dump.data(), sizeof(header));
+    EXPECT_EQ(header.magic, flightRecorderMagic);
+    EXPECT_EQ(header.version, flightRecorderVersion);
+    EXPECT_EQ(header.payloadSize, 4);
+    EXPECT_EQ(header.numRecords, 3);
+
+    // The two oldest messages are overwritten, the others are in order
+    uint64_t lastTimestamp = 0;
+    for (uint8_t i = 2; i < 5; i++)
+    {
+        auto slot = dump.data() + sizeof(header) + (i - 2) * slotSize;
+        FlightRecorderRecordHeader record{};
+        std::memcpy(&record, slot, sizeof(record));
+        EXPECT_EQ(record.length, i + 2);
+        EXPECT_EQ(record.eid, 8 + i);
+        EXPECT_EQ(record.isTx, i % 2 == 0);
+        EXPECT_GE(record.timestamp, lastTimestamp);
+        lastTimestamp = record.timestamp;
+
+        auto payload = slot + sizeof(record);
+        for (size_t j = 0; j < 4; j++)
+        {
+            EXPECT_EQ(payload[j], j < static_cast<size_t>(i + 2) ? i : 0);
+        }
+    }
+}
@@ -5,6 +5,8 @@
 #include <libpldm/transport/mctp-demux.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <memory>
 #include <ranges>
 #include <system_error>
 
@@ -151,6 +153,38 @@ pldm_requester_rc_t PldmTransport::recvMsg(pldm_tid_t& tid, void*& rx,
     return pldm_transport_recv_msg(transport, &tid, (void**)&rx, &len);
 }
 
+pldm_requester_rc_t PldmTransport::recvMsgs(size_t budget,
+                                            const RecvMsgHandler& handler)
+{
+    for (size_t count = 0; count < budget; count++)
+    {
+        if (count && !isMsgPending())
+        {
+            break;
+        }
+
+        pldm_tid_t tid = 0;
+        void* rx = nullptr;
+        size_t len = 0;
+        auto rc = recvMsg(tid, rx, len);
+        std::unique_ptr<void, decltype(&std::free)> rxBuf(rx, &std::free);
+        if (rc != PLDM_REQUESTER_SUCCESS)
+        {
+            return rc;
+        }
+
+        handler(tid, rx, len);
+    }
+
+    return PLDM_REQUESTER_SUCCESS;
+}
+
+bool PldmTransport::isMsgPending() const
+{
+    pollfd readable = {pfd.fd, POLLIN, 0};
+    return poll(&readable, 1, 0) > 0 && (readable.revents & POLLIN);
+}
+
 pldm_requester_rc_t PldmTransport::sendRecvMsg(
     pldm_tid_t tid, const void* tx, size_t txLen, void*& rx, size_t& rxLen)
 {
@@ -5,6 +5,7 @@
 #include <poll.h>
 
 #include <cstddef>
+#include <functional>
 
 struct pldm_transport_mctp_demux;
 struct pldm_transport_af_mctp;
@@ -62,6 +63,29 @@ class PldmTransport
      */
     pldm_requester_rc_t recvMsg(pldm_tid_t& tid, void*& rx, size_t& len);
 
+    /** @brief Handler of a message received by recvMsgs()
+     *
+     * The buffer pointed-to by rx is freed once the handler returns.
+     */
+    using RecvMsgHandler =
+        std::function<void(pldm_tid_t tid, const void* rx, size_t len)>;
+
+    /** @brief Receive the PLDM messages pending on the transport in a batch
+     *
+     * The first message is received unconditionally, further messages are
+     * only received while the transport is readable, so that a burst of
+     * messages is drained on a single wakeup of the event loop. Messages left
+     * over once the budget is exhausted remain readable on the event source.
+     *
+     * @param[in] budget - The maximum number of messages to receive
+     * @param[in] handler - Invoked for each received message
+     *
+     * @return PLDM_REQUESTER_SUCCESS if the pending messages up to the budget
+     *         were received, otherwise the PLDM_REQUESTER_* error code of the
+     *         failed receive.
+     */
+    pldm_requester_rc_t recvMsgs(size_t budget, const RecvMsgHandler& handler);
+
     /** @brief Synchronously exchange a request and response with the specified
      * terminus.
      *
@@ -89,6 +113,12 @@ class PldmTransport
                                     size_t txLen, void*& rx, size_t& rxLen);
 
   private:
+    /** @brief Check without blocking whether a message can be received
+     *
+     * @return true if the transport file descriptor is readable
+     */
+    bool isMsgPending() const;
+
     /** @brief A pollfd object for holding a file descriptor from the libpldm
      *         transport implementation
      */
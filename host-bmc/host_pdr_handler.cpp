@@ -89,7 +89,7 @@ HostPDRHandler::HostPDRHandler(
     pldm_entity_association_tree* bmcEntityTree,
     pldm::InstanceIdDb& instanceIdDb,
     pldm::requester::Handler<pldm::requester::Request>* handler) :
-    mctp_eid(mctp_eid), event(event), repo(repo),
+    mctp_eid(mctp_eid), event(event), repo(repo), pdrRepo(repo),
     stateSensorHandler(eventsJsonsDir), entityTree(entityTree),
     instanceIdDb(instanceIdDb), handler(handler),
     entityMaps(parseEntityMap(ENTITY_MAP_JSON)), oemUtilsHandler(nullptr)
@@ -99,7 +99,7 @@ HostPDRHandler::HostPDRHandler(
         pldm::utils::DBusHandler::getBus(),
         propertiesChanged("/xyz/openbmc_project/state/host0",
                           "xyz.openbmc_project.State.Host"),
-        [this, repo, entityTree, bmcEntityTree](sdbusplus::message_t& msg) {
+        [this, entityTree, bmcEntityTree](sdbusplus::message_t& msg) {
             DbusChangedProps props{};
             std::string intf;
             msg.read(intf, props);
@@ -118,7 +118,7 @@ HostPDRHandler::HostPDRHandler(
                     // when the host is powered off, set the availability
                     // state of all the dbus objects to false
                     this->setPresenceFrus();
-                    pldm_pdr_remove_remote_pdrs(repo);
+                    this->pdrRepo.removeRemoteRecords();
                     pldm_entity_association_tree_destroy_root(entityTree);
                     pldm_entity_association_tree_copy_root(bmcEntityTree,
                                                            entityTree);
@@ -350,17 +350,13 @@ void HostPDRHandler::sendPDRRepositoryChgEvent(std::vector<uint8_t>&& pdrTypes,
         numsOfChangeEntries.size());
     for (auto pdrType : pdrTypes)
     {
-        const pldm_pdr_record* record{};
-        do
+        for (const auto& record : pdrRepo.getRecordsByType(pdrType))
         {
-            record = pldm_pdr_find_record_by_type(repo, pdrType, record,
-                                                  nullptr, nullptr);
-            if (record && pldm_pdr_record_is_remote(record))
+            if (pldm_pdr_record_is_remote(record.record))
             {
-                changeEntries[0].push_back(
-                    pldm_pdr_get_record_handle(repo, record));
+                changeEntries[0].push_back(record.recordHandle);
             }
-        } while (record);
+        }
     }
     if (changeEntries.empty())
     {
@@ -296,6 +296,9 @@ class HostPDRHandler
     /** @brief pointer to BMC's primary PDR repo, host PDRs are added here */
     pldm_pdr* repo;
 
+    /** @brief BMC's primary PDR repo indexed for lookups */
+    pldm::responder::pdr_utils::Repo pdrRepo;
+
     pldm::responder::events::StateSensorHandler stateSensorHandler;
     /** @brief Pointer to BMC's and Host's entity association tree */
     pldm_entity_association_tree* entityTree;
@@ -1,11 +1,16 @@
 #include "pdr.hpp"
 
+#include <endian.h>
+#include <fcntl.h>
 #include <libpldm/fru.h>
 #include <libpldm/platform.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <phosphor-logging/lg2.hpp>
 
 #include <climits>
+#include <cstring>
 
 PHOSPHOR_LOG2_USING;
 
@@ -89,6 +94,403 @@ bool Repo::empty()
     return !getRecordCount();
 }
 
+void Repo::indexRecord(const IndexedRecord& record) const
+{
+    auto position = records.size();
+    records.emplace_back(record);
+    recordsByHandle.emplace(record.recordHandle, position);
+    if (record.size < sizeof(pldm_pdr_hdr))
+    {
+        return;
+    }
+    auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(record.data);
+    recordsByType[pdrHdr->type].emplace_back(position);
+
+    // The composite sensors and effecters are indexed by their entity type
+    // and each of their state sets, a record being indexed once per state set
+    const uint8_t* states = nullptr;
+    uint8_t compositeCount = 0;
+    uint16_t entityType = 0;
+    if (pdrHdr->type == PLDM_STATE_EFFECTER_PDR &&
+        record.size >= sizeof(pldm_state_effecter_pdr))
+    {
+        auto pdr = reinterpret_cast<const pldm_state_effecter_pdr*>(
+            record.data);
+        states = pdr->possible_states;
+        compositeCount = pdr->composite_effecter_count;
+        entityType = pdr->entity_type;
+    }
+    else if (pdrHdr->type == PLDM_STATE_SENSOR_PDR &&
+             record.size >= sizeof(pldm_state_sensor_pdr))
+    {
+        auto pdr = reinterpret_cast<const pldm_state_sensor_pdr*>(
+            record.data);
+        states = pdr->possible_states;
+        compositeCount = pdr->composite_sensor_count;
+        entityType = pdr->entity_type;
+    }
+
+    // state_sensor_possible_states has the same layout
+    constexpr auto statesHeaderSize = sizeof(uint16_t) + sizeof(uint8_t);
+    const uint8_t* end = record.data + record.size;
+    for (uint8_t i = 0; states && i < compositeCount; i++)
+    {
+        if (states + statesHeaderSize > end)
+        {
+            break;
+        }
+        auto possibleStates =
+            reinterpret_cast<const state_effecter_possible_states*>(states);
+        uint16_t stateSetId = possibleStates->state_set_id;
+        auto& positions =
+            recordsByState[StateKey{pdrHdr->type, entityType, stateSetId}];
+        if (positions.empty() || positions.back() != position)
+        {
+            positions.emplace_back(position);
+        }
+        states += statesHeaderSize + possibleStates->possible_states_size;
+    }
+}
+
+void Repo::updateIndex() const
+{
+    auto recordCount = pldm_pdr_get_record_count(repo);
+    auto clearIndex = [this]() {
+        records.clear();
+        recordsByHandle.clear();
+        recordsByType.clear();
+        recordsByState.clear();
+    };
+    if (indexGeneration != generation || recordCount < records.size())
+    {
+        clearIndex();
+        indexGeneration = generation;
+    }
+
+    // Index the records following the last indexed one, or all the records
+    // if some were inserted before it
+    for (auto pass = 0; pass < 2 && recordCount != records.size(); pass++)
+    {
+        if (pass)
+        {
+            clearIndex();
+        }
+        IndexedRecord indexed{};
+        uint32_t nextRecordHandle = 0;
+        if (records.empty())
+        {
+            indexed.record = pldm_pdr_find_record(
+                repo, 0, &indexed.data, &indexed.size, &nextRecordHandle);
+        }
+        else
+        {
+            indexed.record = pldm_pdr_get_next_record(
+                repo, records.back().record, &indexed.data, &indexed.size,
+                &nextRecordHandle);
+        }
+        while (indexed.record)
+        {
+            indexed.recordHandle =
+                pldm_pdr_get_record_handle(repo, indexed.record);
+            indexRecord(indexed);
+            indexed.record =
+                pldm_pdr_get_next_record(repo, indexed.record, &indexed.data,
+                                         &indexed.size, &nextRecordHandle);
+        }
+    }
+}
+
+std::vector<IndexedRecord> Repo::getRecords(
+    const std::vector<size_t>& positions) const
+{
+    std::vector<IndexedRecord> found;
+    found.reserve(positions.size());
+    for (auto position : positions)
+    {
+        found.emplace_back(records[position]);
+    }
+    return found;
+}
+
+const pldm_pdr_record* Repo::getRecordByHandle(RecordHandle recordHandle,
+                                               PdrEntry& pdrEntry) const
+{
+    updateIndex();
+    size_t position = 0;
+    if (recordHandle)
+    {
+        auto it = recordsByHandle.find(recordHandle);
+        if (it == recordsByHandle.end())
+        {
+            return nullptr;
+        }
+        position = it->second;
+    }
+    else if (records.empty())
+    {
+        return nullptr;
+    }
+
+    const auto& record = records[position];
+    pdrEntry.data = record.data;
+    pdrEntry.size = record.size;
+    pdrEntry.handle.nextRecordHandle =
+        (position + 1 < records.size()) ? records[position + 1].recordHandle
+                                        : 0;
+    return record.record;
+}
+
+std::vector<IndexedRecord> Repo::getRecordsByType(Type pdrType) const
+{
+    updateIndex();
+    auto it = recordsByType.find(pdrType);
+    if (it == recordsByType.end())
+    {
+        return {};
+    }
+    return getRecords(it->second);
+}
+
+std::vector<IndexedRecord> Repo::findStateEffecterRecords(
+    uint16_t entityType, uint16_t stateSetId) const
+{
+    updateIndex();
+    auto it = recordsByState.find(
+        StateKey{PLDM_STATE_EFFECTER_PDR, entityType, stateSetId});
+    if (it == recordsByState.end())
+    {
+        return {};
+    }
+    return getRecords(it->second);
+}
+
+std::vector<IndexedRecord> Repo::findStateSensorRecords(
+    uint16_t entityType, uint16_t stateSetId) const
+{
+    updateIndex();
+    auto it = recordsByState.find(
+        StateKey{PLDM_STATE_SENSOR_PDR, entityType, stateSetId});
+    if (it == recordsByState.end())
+    {
+        return {};
+    }
+    return getRecords(it->second);
+}
+
+void Repo::removeRecordsByTerminusHandle(uint16_t terminusHandle)
+{
+    pldm_pdr_remove_pdrs_by_terminus_handle(repo, terminusHandle);
+    invalidateIndexes();
+}
+
+void Repo::removeRemoteRecords()
+{
+    pldm_pdr_remove_remote_pdrs(repo);
+    invalidateIndexes();
+}
+
+void Repo::invalidateIndexes()
+{
+    generation++;
+}
+
+/** @brief Magic at the start of a PDR JSON image */
+constexpr std::array<char, 8> pdrJsonImageMagic = {'P', 'L', 'D', 'M',
+                                                   'P', 'D', 'R', 'I'};
+
+/** @brief Version of the PDR JSON image format */
+constexpr uint16_t pdrJsonImageVersion = 2;
+
+/** @struct JsonImageHeader
+ *
+ *  Header of a PDR JSON image, followed by an index of indexSize bytes and
+ *  the encoded PDR JSON files of each directory. The index is a CBOR object
+ *  of the directories to the offset and size of their files after the index
+ *  and to the names and sizes of the PDR JSON files the image was made from.
+ *  The fields are little endian.
+ */
+struct __attribute__((packed)) JsonImageHeader
+{
+    std::array<char, 8> magic; //!< pdrJsonImageMagic
+    uint16_t version;          //!< pdrJsonImageVersion
+    uint32_t indexSize;        //!< size of the index in bytes
+};
+
+void JsonImage::Unmap::operator()(void* image) const
+{
+    munmap(image, size);
+}
+
+std::optional<Json> JsonImage::decode(const std::string& directory) const
+{
+    auto it = directories.find(directory);
+    if (it == directories.end())
+    {
+        return std::nullopt;
+    }
+
+    auto files = Json::from_cbor(it->second.begin(), it->second.end(), true,
+                                 false);
+    if (files.is_discarded() || !files.is_object())
+    {
+        error("Failed to decode the PDR JSON image of directory '{DIRECTORY}'",
+              "DIRECTORY", directory);
+        return std::nullopt;
+    }
+    return files;
+}
+
+/** @brief Check if a PDR JSON file changed after the PDR JSON image was made
+ *
+ *  @param[in] dir - the PDR JSON directory
+ *  @param[in] imageTime - modification time of the PDR JSON image
+ *
+ *  @return true if a file of the directory or of its subdirectories is newer
+ *          than the image
+ */
+static bool isJsonImageStale(const fs::path& dir,
+                             fs::file_time_type imageTime)
+{
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(dir, ec);
+         !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+    {
+        if (it->is_regular_file(ec) &&
+            it->path().filename() != pdrJsonImageName &&
+            it->last_write_time(ec) > imageTime)
+        {
+            info("PDR JSON file '{PATH}' is newer than the PDR JSON image",
+                 "PATH", it->path());
+            return true;
+        }
+    }
+    return static_cast<bool>(ec);
+}
+
+/** @brief Check if a directory holds the PDR JSON files the PDR JSON image
+ *         was made from
+ *
+ *  @param[in] directory - the directory
+ *  @param[in] files - object of the file names in the image to their sizes
+ *
+ *  @return true if the directory holds the files of the image and no other
+ *          file, with the sizes of the image
+ */
+static bool isJsonImageCurrent(const fs::path& directory, const Json& files)
+{
+    std::error_code ec;
+    size_t count = 0;
+    for (auto it = fs::directory_iterator(directory, ec);
+         !ec && it != fs::directory_iterator(); it.increment(ec))
+    {
+        auto name = it->path().filename().string();
+        if (!it->is_regular_file(ec) || name == pdrJsonImageName)
+        {
+            continue;
+        }
+
+        auto file = files.find(name);
+        if (file == files.end() || !file->is_number_unsigned() ||
+            file->get<uintmax_t>() != it->file_size(ec))
+        {
+            return false;
+        }
+        count++;
+    }
+    return !ec && count == files.size();
+}
+
+std::optional<JsonImage> readJsonImage(const fs::path& dir)
+{
+    auto path = dir / pdrJsonImageName;
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        return std::nullopt;
+    }
+    pldm::utils::CustomFD imageFd(fd);
+
+    struct stat sb;
+    if (fstat(imageFd(), &sb) == -1)
+    {
+        error("Failed to get the size of the PDR JSON image '{PATH}'", "PATH",
+              path);
+        return std::nullopt;
+    }
+    size_t size = sb.st_size;
+    if (size < sizeof(JsonImageHeader))
+    {
+        error("Ignoring invalid PDR JSON image '{PATH}'", "PATH", path);
+        return std::nullopt;
+    }
+
+    std::error_code ec;
+    auto imageTime = fs::last_write_time(path, ec);
+    if (ec || isJsonImageStale(dir, imageTime))
+    {
+        return std::nullopt;
+    }
+
+    void* fileInMemory =
+        mmap(nullptr, size, PROT_READ, MAP_PRIVATE, imageFd(), 0);
+    if (MAP_FAILED == fileInMemory)
+    {
+        error("mmap on PDR JSON image '{PATH}' failed with error {RC}", "PATH",
+              path, "RC", -errno);
+        return std::nullopt;
+    }
+    JsonImage jsonImage;
+    jsonImage.image = std::unique_ptr<void, JsonImage::Unmap>(
+        fileInMemory, JsonImage::Unmap{size});
+
+    std::span<const uint8_t> data(static_cast<const uint8_t*>(fileInMemory),
+                                  size);
+    JsonImageHeader header{};
+    std::memcpy(&header, data.data(), sizeof(header));
+    data = data.subspan(sizeof(header));
+    if (header.magic != pdrJsonImageMagic ||
+        le16toh(header.version) != pdrJsonImageVersion ||
+        le32toh(header.indexSize) > data.size())
+    {
+        error("Ignoring invalid PDR JSON image '{PATH}'", "PATH", path);
+        return std::nullopt;
+    }
+    auto index = data.first(le32toh(header.indexSize));
+    data = data.subspan(index.size());
+
+    try
+    {
+        auto directories = Json::from_cbor(index.begin(), index.end());
+        for (const auto& [directory, location] : directories.items())
+        {
+            auto offset = location.at(0).get<size_t>();
+            auto length = location.at(1).get<size_t>();
+            if (offset > data.size() || length > data.size() - offset)
+            {
+                error("Ignoring invalid PDR JSON image '{PATH}'", "PATH",
+                      path);
+                return std::nullopt;
+            }
+            if (!isJsonImageCurrent(dir / directory, location.at(2)))
+            {
+                info(
+                    "PDR JSON files of '{DIRECTORY}' differ from the PDR JSON image",
+                    "DIRECTORY", dir / directory);
+                continue;
+            }
+            jsonImage.directories.emplace(directory,
+                                          data.subspan(offset, length));
+        }
+    }
+    catch (const Json::exception& e)
+    {
+        error("Ignoring invalid PDR JSON image '{PATH}', error - {ERROR}",
+              "PATH", path, "ERROR", e);
+        return std::nullopt;
+    }
+    return jsonImage;
+}
+
 StatestoDbusVal populateMapping(const std::string& type, const Json& dBusValues,
                                 const PossibleValues& pv)
 {
@@ -14,7 +14,14 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 PHOSPHOR_LOG2_USING;
 
@@ -81,6 +88,17 @@ using DbusMappings = std::vector<pldm::utils::DBusMapping>;
 using DbusValMaps = std::vector<StatestoDbusVal>;
 using EventStates = std::array<uint8_t, 8>;
 
+/** @struct IndexedRecord
+ *  PDR record found through the index of a PDR repository
+ */
+struct IndexedRecord
+{
+    const pldm_pdr_record* record; //!< opaque pointer to the PDR record
+    uint8_t* data;                 //!< PDR data
+    uint32_t size;                 //!< PDR size
+    RecordHandle recordHandle;     //!< PDR record handle
+};
+
 /** @brief Parse PDR JSON file and output Json object
  *
  *  @param[in] path - path of PDR JSON file
@@ -105,6 +123,58 @@ inline Json readJson(const std::string& path)
     return Json::parse(jsonFile);
 }
 
+/** @brief Name of the PDR JSON image in the PDR JSON directory */
+constexpr auto pdrJsonImageName = "pdr_image.bin";
+
+/**
+ *  @class JsonImage
+ *
+ *  The PDR JSON image of a PDR JSON directory mapped in memory. The image is
+ *  created at build time by pldm_pdr_image_creator.py, it holds the PDR JSON
+ *  files of the directory and of its subdirectories already parsed and
+ *  encoded in CBOR, which decodes without parsing text. The files of a
+ *  directory are only decoded when used.
+ */
+class JsonImage
+{
+  public:
+    /** @brief Decode the PDR JSON files of a directory
+     *
+     *  @param[in] directory - the directory relative to the PDR JSON
+     *                         directory, "." being the PDR JSON directory
+     *
+     *  @return object of the file names to their content, std::nullopt if the
+     *          image does not hold the directory
+     */
+    std::optional<Json> decode(const std::string& directory) const;
+
+  private:
+    friend std::optional<JsonImage> readJsonImage(const fs::path& dir);
+
+    /** @brief Unmap the image */
+    struct Unmap
+    {
+        size_t size;
+        void operator()(void* image) const;
+    };
+
+    /** @brief The mapped image */
+    std::unique_ptr<void, Unmap> image;
+
+    /** @brief Map of the directory to its encoded PDR JSON files */
+    std::map<std::string, std::span<const uint8_t>> directories;
+};
+
+/** @brief Read the PDR JSON image of a PDR JSON directory
+ *
+ *  @param[in] dir - the PDR JSON directory
+ *
+ *  @return the image, std::nullopt if the image is missing, invalid or older
+ *          than one of the PDR JSON files. The image holds no directory which
+ *          PDR JSON file names or sizes differ from the image.
+ */
+std::optional<JsonImage> readJsonImage(const fs::path& dir);
+
 /** @brief Populate the mapping between D-Bus property stateId and attribute
  *          value for the effecter PDR enumeration attribute.
  *
@@ -179,6 +249,17 @@ class RepoInterface
      */
     virtual uint32_t getRecordCount() = 0;
 
+    /** @brief Find a PDR record by its record handle
+     *
+     *  @param[in] recordHandle - record handle, 0 for the first record
+     *  @param[out] pdrEntry - PDR records entry(data, size, nextRecordHandle)
+     *
+     *  @return opaque pointer acting as PDR record handle, will be NULL if
+     *          record was not found
+     */
+    virtual const pldm_pdr_record* getRecordByHandle(
+        RecordHandle recordHandle, PdrEntry& pdrEntry) const = 0;
+
     /** @brief Determine if records are empty in a PDR repository
      *
      *  @return bool - true means empty and false means not empty
@@ -194,7 +275,12 @@ class RepoInterface
  *
  *  Wrapper class to handle the PDR APIs
  *
- *  This class wraps operations used to handle PDR APIs.
+ *  This class wraps operations used to handle PDR APIs. The lookups go
+ *  through an index of the records, by record handle, by PDR type and by
+ *  entity type and state set of the state sensors and effecters. libpldm
+ *  only adds records at the end of the repository, so the index is brought
+ *  up to date by indexing the records added since the previous lookup, and
+ *  is rebuilt after records are removed.
  */
 class Repo : public RepoInterface
 {
@@ -215,6 +301,93 @@ class Repo : public RepoInterface
     uint32_t getRecordCount() override;
 
     bool empty() override;
+
+    const pldm_pdr_record* getRecordByHandle(
+        RecordHandle recordHandle, PdrEntry& pdrEntry) const override;
+
+    /** @brief Get the PDR records of a PDR type
+     *
+     *  @param[in] pdrType - PDR type
+     *
+     *  @return the records, in the repository order
+     */
+    std::vector<IndexedRecord> getRecordsByType(Type pdrType) const;
+
+    /** @brief Get the state effecter PDRs of an entity type with a state set
+     *
+     *  @param[in] entityType - entity type of the effecter
+     *  @param[in] stateSetId - state set of one of the composite effecters
+     *
+     *  @return the records, in the repository order
+     */
+    std::vector<IndexedRecord> findStateEffecterRecords(
+        uint16_t entityType, uint16_t stateSetId) const;
+
+    /** @brief Get the state sensor PDRs of an entity type with a state set
+     *
+     *  @param[in] entityType - entity type of the sensor
+     *  @param[in] stateSetId - state set of one of the composite sensors
+     *
+     *  @return the records, in the repository order
+     */
+    std::vector<IndexedRecord> findStateSensorRecords(
+        uint16_t entityType, uint16_t stateSetId) const;
+
+    /** @brief Remove the PDR records of a terminus
+     *
+     *  @param[in] terminusHandle - PLDM terminus handle of the records
+     */
+    void removeRecordsByTerminusHandle(uint16_t terminusHandle);
+
+    /** @brief Remove the remote PDR records */
+    void removeRemoteRecords();
+
+    /** @brief Invalidate the index of every repository, to call after
+     *         removing records through libpldm directly
+     */
+    static void invalidateIndexes();
+
+  private:
+    /** @brief Index the records added since the previous lookup, or all
+     *         the records if records were removed
+     */
+    void updateIndex() const;
+
+    /** @brief Add a record at the end of the index
+     *
+     *  @param[in] record - the indexed record
+     */
+    void indexRecord(const IndexedRecord& record) const;
+
+    /** @brief Get the indexed records at positions
+     *
+     *  @param[in] positions - positions of the records in the index
+     *
+     *  @return the records
+     */
+    std::vector<IndexedRecord> getRecords(
+        const std::vector<size_t>& positions) const;
+
+    /** @brief Generation of the indexes, incremented to invalidate them */
+    static inline uint64_t generation = 0;
+
+    /** @brief Generation of the index of this repository */
+    mutable uint64_t indexGeneration = 0;
+
+    /** @brief Indexed records, in the repository order */
+    mutable std::vector<IndexedRecord> records;
+
+    /** @brief Positions of the records by record handle */
+    mutable std::unordered_map<RecordHandle, size_t> recordsByHandle;
+
+    /** @brief Positions of the records by PDR type */
+    mutable std::map<Type, std::vector<size_t>> recordsByType;
+
+    /** @brief PDR type, entity type and state set */
+    using StateKey = std::tuple<Type, uint16_t, uint16_t>;
+
+    /** @brief Positions of the state sensor and effecter records */
+    mutable std::map<StateKey, std::vector<size_t>> recordsByState;
 };
 
 /** @brief Parse the State Sensor PDR and return the parsed sensor info which
@@ -19,6 +19,9 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
+#include <vector>
+
 PHOSPHOR_LOG2_USING;
 
 using namespace pldm::utils;
@@ -105,58 +108,99 @@ void Handler::generate(const pldm::utils::DBusHandler& dBusIntf,
          }}};
 
     Type pdrType{};
+    auto generateFromJson = [&](const Json& json) {
+        if (json.empty())
+        {
+            return;
+        }
+        auto effecterPDRs = json.value("effecterPDRs", empty);
+        for (const auto& effecter : effecterPDRs)
+        {
+            pdrType = effecter.value("pdrType", 0);
+            generateHandlers.at(pdrType)(dBusIntf, effecter, repo);
+        }
+
+        auto sensorPDRs = json.value("sensorPDRs", empty);
+        for (const auto& sensor : sensorPDRs)
+        {
+            pdrType = sensor.value("pdrType", 0);
+            generateHandlers.at(pdrType)(dBusIntf, sensor, repo);
+        }
+    };
+
+    auto generateFromFile = [&](const fs::path& path, auto&& getJson) {
+        try
+        {
+            generateFromJson(getJson());
+        }
+        catch (const InternalFailure& e)
+        {
+            error(
+                "PDR config directory '{PATH}' does not exist or empty for '{TYPE}' pdr, error - {ERROR}",
+                "PATH", path, "TYPE", pdrType, "ERROR", e);
+        }
+        catch (const Json::exception& e)
+        {
+            error(
+                "Failed to parse PDR JSON file for '{TYPE}' pdr, error - {ERROR}",
+                "TYPE", pdrType, "ERROR", e);
+            pldm::utils::reportError(
+                "xyz.openbmc_project.PLDM.Error.Generate.PDRJsonFileParseFail");
+        }
+        catch (const std::exception& e)
+        {
+            error(
+                "Failed to parse PDR JSON file for '{TYPE}' pdr, error - {ERROR}",
+                "TYPE", pdrType, "ERROR", e);
+            pldm::utils::reportError(
+                "xyz.openbmc_project.PLDM.Error.Generate.PDRJsonFileParseFail");
+        }
+    };
+
     for (const auto& directory : dir)
     {
-        for (const auto& dirEntry : fs::directory_iterator(directory))
+        // The PDR JSON image made at build time holds the PDR JSON files
+        // already parsed, the files are parsed when the image does not hold
+        // the directory
+        std::optional<Json> files;
+        if (pdrJsonImage)
         {
-            try
-            {
-                if (fs::is_regular_file(dirEntry.path().string()))
-                {
-                    auto json = readJson(dirEntry.path().string());
-                    if (!json.empty())
-                    {
-                        auto effecterPDRs = json.value("effecterPDRs", empty);
-                        for (const auto& effecter : effecterPDRs)
-                        {
-                            pdrType = effecter.value("pdrType", 0);
-                            generateHandlers.at(
-                                pdrType)(dBusIntf, effecter, repo);
-                        }
-
-                        auto sensorPDRs = json.value("sensorPDRs", empty);
-                        for (const auto& sensor : sensorPDRs)
-                        {
-                            pdrType = sensor.value("pdrType", 0);
-                            generateHandlers.at(
-                                pdrType)(dBusIntf, sensor, repo);
-                        }
-                    }
-                }
-            }
-            catch (const InternalFailure& e)
-            {
-                error(
-                    "PDR config directory '{PATH}' does not exist or empty for '{TYPE}' pdr, error - {ERROR}",
-                    "PATH", dirEntry.path(), "TYPE", pdrType, "ERROR", e);
-            }
-            catch (const Json::exception& e)
+            files = pdrJsonImage->decode(
+                directory.lexically_relative(pdrJsonDir).string());
+        }
+        if (files)
+        {
+            for (const auto& file : files->items())
             {
-                error(
-                    "Failed to parse PDR JSON file for '{TYPE}' pdr, error - {ERROR}",
-                    "TYPE", pdrType, "ERROR", e);
-                pldm::utils::reportError(
-                    "xyz.openbmc_project.PLDM.Error.Generate.PDRJsonFileParseFail");
+                generateFromFile(directory / file.key(),
+                                 [&file]() -> const Json& {
+                                     return file.value();
+                                 });
             }
-            catch (const std::exception& e)
+            continue;
+        }
+
+        // Generate in the order of the image, which sorts the file names
+        std::vector<fs::path> paths;
+        for (const auto& dirEntry : fs::directory_iterator(directory))
+        {
+            if (dirEntry.path().filename() != pdrJsonImageName)
             {
-                error(
-                    "Failed to parse PDR JSON file for '{TYPE}' pdr, error - {ERROR}",
-                    "TYPE", pdrType, "ERROR", e);
-                pldm::utils::reportError(
-                    "xyz.openbmc_project.PLDM.Error.Generate.PDRJsonFileParseFail");
+                paths.emplace_back(dirEntry.path());
             }
         }
+        std::ranges::sort(paths);
+
+        for (const auto& path : paths)
+        {
+            generateFromFile(path, [&path]() {
+                if (!fs::is_regular_file(path.string()))
+                {
+                    return Json{};
+                }
+                return readJson(path.string());
+            });
+        }
     }
 }
 
@@ -202,6 +246,7 @@ Response Handler::getPDR(const pldm_msg* request, size_t payloadLength)
         generate(*dBusIntf, pdrJsonsDir, pdrRepo);
 
         pdrCreated = true;
+        pdrJsonImage.reset();
 
         if (dbusToPLDMEventHandler)
         {
@@ -607,8 +652,7 @@ int Handler::pldmPDRRepositoryChgEvent(
             {
                 if (std::get<0>(it->second) == tid)
                 {
-                    pldm_pdr_remove_pdrs_by_terminus_handle(pdrRepo.getPdr(),
-                                                            it->first);
+                    pdrRepo.removeRecordsByTerminusHandle(it->first);
                     hostPDRHandler->tlPDRInfo.erase(it++);
                 }
                 else
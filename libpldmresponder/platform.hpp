@@ -63,13 +63,15 @@ class Handler : public CmdHandler
         dbusToPLDMEventHandler(dbusToPLDMEventHandler), fruHandler(fruHandler),
         dBusIntf(dBusIntf), platformConfigHandler(platformConfigHandler),
         handler(handler), event(event), pdrJsonDir(pdrJsonDir),
-        pdrCreated(false), pdrJsonsDir({pdrJsonDir})
+        pdrCreated(false), pdrJsonsDir({pdrJsonDir}),
+        pdrJsonImage(pdr_utils::readJsonImage(pdrJsonDir))
     {
         if (!buildPDRLazily)
         {
             generateTerminusLocatorPDR(pdrRepo);
             generate(*dBusIntf, pdrJsonsDir, pdrRepo);
             pdrCreated = true;
+            pdrJsonImage.reset();
         }
 
         handlers.emplace(
@@ -531,6 +533,12 @@ class Handler : public CmdHandler
     fs::path pdrJsonDir;
     bool pdrCreated;
     std::vector<fs::path> pdrJsonsDir;
+
+    /** @brief PDR JSON image mapped at startup, released once the PDRs are
+     *         generated
+     */
+    std::optional<pdr_utils::JsonImage> pdrJsonImage;
+
     std::unique_ptr<sdeventplus::source::Defer> deferredGetPDREvent;
 };
 
@@ -2,11 +2,16 @@
 #include "libpldmresponder/pdr_utils.hpp"
 #include "libpldmresponder/platform.hpp"
 
+#include <endian.h>
 #include <libpldm/platform.h>
 
 #include <sdbusplus/test/sdbus_mock.hpp>
 #include <sdeventplus/event.hpp>
 
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+
 #include <gtest/gtest.h>
 
 using namespace pldm::responder;
@@ -118,6 +123,127 @@ TEST(GeneratePDRByStateEffecter, testGoodJson)
     pldm_pdr_destroy(outPDRRepo);
 }
 
+/** @brief Write a PDR JSON image as made by pldm_pdr_image_creator.py
+ *
+ *  @param[in] dir - the PDR JSON directory
+ *  @param[in] directories - object of the directories to their PDR JSON files,
+ *                           the files exist in the PDR JSON directory
+ */
+static void writeJsonImage(const fs::path& dir, const Json& directories)
+{
+    Json index = Json::object();
+    std::vector<uint8_t> data;
+    for (const auto& [directory, files] : directories.items())
+    {
+        auto encoded = Json::to_cbor(files);
+        Json sizes = Json::object();
+        for (const auto& file : files.items())
+        {
+            sizes[file.key()] = fs::file_size(dir / directory / file.key());
+        }
+        index[directory] = {data.size(), encoded.size(), sizes};
+        data.insert(data.end(), encoded.begin(), encoded.end());
+    }
+    auto encodedIndex = Json::to_cbor(index);
+    uint16_t version = htole16(2);
+    uint32_t indexSize = htole32(encodedIndex.size());
+
+    std::ofstream image(dir / pdrJsonImageName, std::ios::binary);
+    image.write("PLDMPDRI", 8);
+    image.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    image.write(reinterpret_cast<const char*>(&indexSize), sizeof(indexSize));
+    image.write(reinterpret_cast<const char*>(encodedIndex.data()),
+                encodedIndex.size());
+    image.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+TEST(GeneratePDRByStateEffecter, testJsonImage)
+{
+    char tmpdir[] = "/tmp/pldm_pdr_image.XXXXXX";
+    fs::path dir(mkdtemp(tmpdir));
+    EXPECT_FALSE(readJsonImage(dir).has_value());
+
+    auto json = readJson("./pdr_jsons/state_effecter/good/effecter_pdr.json");
+    auto jsonFile = dir / "effecter_pdr.json";
+    std::ofstream(jsonFile) << json;
+    Json directories;
+    directories["."]["effecter_pdr.json"] = json;
+    writeJsonImage(dir, directories);
+
+    // The file is not valid JSON, its size and its time match the image
+    auto imageTime = fs::last_write_time(dir / pdrJsonImageName);
+    auto size = fs::file_size(jsonFile);
+    std::ofstream(jsonFile, std::ios::trunc) << std::string(size, '{');
+    fs::last_write_time(jsonFile, imageTime - std::chrono::hours(1));
+
+    auto image = readJsonImage(dir);
+    ASSERT_TRUE(image.has_value());
+    auto files = image->decode(".");
+    ASSERT_TRUE(files.has_value());
+    EXPECT_EQ(files->at("effecter_pdr.json"), json);
+    EXPECT_FALSE(image->decode("missing").has_value());
+
+    // The PDRs are generated from the image, the file is not parsed
+    MockdBusHandler mockedUtils;
+    EXPECT_CALL(mockedUtils, getService(StrEq("/foo/bar"), _))
+        .Times(5)
+        .WillRepeatedly(Return("foo.bar"));
+
+    auto inPDRRepo = pldm_pdr_init();
+    auto outPDRRepo = pldm_pdr_init();
+    Repo outRepo(outPDRRepo);
+    auto event = sdeventplus::Event::get_default();
+    Handler handler(&mockedUtils, 0, nullptr, dir, inPDRRepo, nullptr, nullptr,
+                    nullptr, nullptr, nullptr, event);
+    Repo inRepo(inPDRRepo);
+    getRepoByType(inRepo, outRepo, PLDM_STATE_EFFECTER_PDR);
+    ASSERT_EQ(outRepo.getRecordCount(), 2);
+
+    pdr_utils::PdrEntry e;
+    auto record = pdr::getRecordByHandle(outRepo, 3, e);
+    ASSERT_NE(record, nullptr);
+    auto pdr = new (e.data) pldm_state_effecter_pdr;
+    EXPECT_EQ(pdr->effecter_id, 2);
+    EXPECT_EQ(pdr->entity_type, 100);
+
+    // The files of a directory which differ in size from the image, which
+    // were removed or added are parsed instead of the image
+    std::ofstream(jsonFile, std::ios::app) << ' ';
+    fs::last_write_time(jsonFile, imageTime - std::chrono::hours(1));
+    image = readJsonImage(dir);
+    ASSERT_TRUE(image.has_value());
+    EXPECT_FALSE(image->decode(".").has_value());
+
+    fs::remove(jsonFile);
+    image = readJsonImage(dir);
+    ASSERT_TRUE(image.has_value());
+    EXPECT_FALSE(image->decode(".").has_value());
+
+    std::ofstream(jsonFile) << std::string(size, '{');
+    fs::last_write_time(jsonFile, imageTime - std::chrono::hours(1));
+    std::ofstream(dir / "other.json") << json;
+    fs::last_write_time(dir / "other.json", imageTime - std::chrono::hours(1));
+    image = readJsonImage(dir);
+    ASSERT_TRUE(image.has_value());
+    EXPECT_FALSE(image->decode(".").has_value());
+    fs::remove(dir / "other.json");
+    EXPECT_TRUE(readJsonImage(dir)->decode(".").has_value());
+
+    // A PDR JSON file newer than the image is parsed instead of the image
+    fs::last_write_time(jsonFile, imageTime + std::chrono::hours(1));
+    EXPECT_FALSE(readJsonImage(dir).has_value());
+
+    // An invalid image is ignored
+    std::ofstream(dir / pdrJsonImageName, std::ios::trunc) << "PLDMPDRI";
+    fs::last_write_time(dir / pdrJsonImageName,
+                        fs::last_write_time(jsonFile) + std::chrono::hours(1));
+    EXPECT_FALSE(readJsonImage(dir).has_value());
+
+    pldm_pdr_destroy(inPDRRepo);
+    pldm_pdr_destroy(outPDRRepo);
+    fs::remove_all(dir);
+}
+
 TEST(GeneratePDRByNumericEffecter, testGoodJson)
 {
     MockdBusHandler mockedUtils;
@@ -216,3 +342,53 @@ TEST(findStateEffecterId, goodJson)
     ASSERT_EQ(effecterId, PLDM_INVALID_EFFECTER_ID);
     pldm_pdr_destroy(inPDRRepo);
 }
+
+TEST(RepoIndex, testLookups)
+{
+    auto pdrRepo = pldm_pdr_init();
+    Repo repo(pdrRepo);
+
+    std::vector<uint8_t> pdr(
+        sizeof(struct pldm_state_effecter_pdr) - sizeof(uint8_t) +
+        sizeof(struct state_effecter_possible_states));
+    auto rec = new (pdr.data()) pldm_state_effecter_pdr;
+    auto state = new (rec->possible_states) state_effecter_possible_states;
+    rec->hdr.type = PLDM_STATE_EFFECTER_PDR;
+    rec->entity_type = 33;
+    rec->composite_effecter_count = 1;
+    state->state_set_id = 196;
+    state->possible_states_size = 1;
+
+    uint32_t handle = 0;
+    ASSERT_EQ(pldm_pdr_add(pdrRepo, pdr.data(), pdr.size(), false, 1, &handle),
+              0);
+    auto records = repo.findStateEffecterRecords(33, 196);
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].recordHandle, handle);
+    EXPECT_TRUE(repo.findStateEffecterRecords(33, 197).empty());
+    EXPECT_TRUE(repo.findStateSensorRecords(33, 196).empty());
+
+    // The records added to the repository since the last lookup are indexed
+    handle = 0;
+    ASSERT_EQ(pldm_pdr_add(pdrRepo, pdr.data(), pdr.size(), false, 2, &handle),
+              0);
+    EXPECT_EQ(repo.findStateEffecterRecords(33, 196).size(), 2);
+    EXPECT_EQ(repo.getRecordsByType(PLDM_STATE_EFFECTER_PDR).size(), 2);
+
+    PdrEntry e{};
+    auto record = pdr::getRecordByHandle(repo, 0, e);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(e.size, pdr.size());
+    EXPECT_EQ(e.handle.nextRecordHandle, handle);
+    record = pdr::getRecordByHandle(repo, handle, e);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(e.handle.nextRecordHandle, 0);
+
+    // The index is rebuilt after removing records
+    repo.removeRecordsByTerminusHandle(1);
+    EXPECT_EQ(repo.findStateEffecterRecords(33, 196).size(), 1);
+    EXPECT_EQ(pdr::getRecordByHandle(repo, 1, e), nullptr);
+    EXPECT_NE(pdr::getRecordByHandle(repo, handle, e), nullptr);
+
+    pldm_pdr_destroy(pdrRepo);
+}
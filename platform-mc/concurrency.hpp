@@ -0,0 +1,49 @@
+#pragma once
+
+#include <sdbusplus/async.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @brief Run a coroutine for each item, with a bounded number of them in
+ *         progress at a time
+ *
+ *  The items are handed out in order to maxConcurrency workers spawned in an
+ *  async scope, each worker awaiting one coroutine at a time.
+ *
+ *  @param[in] items - the items, which must outlive the returned task
+ *  @param[in] maxConcurrency - most coroutines in progress at a time
+ *  @param[in] func - returns the coroutine to await for an item
+ *
+ *  @return coroutine completing once the coroutines of all the items
+ *          completed
+ */
+template <typename T, typename Func>
+exec::task<void> forEachConcurrently(const std::vector<T>& items,
+                                     size_t maxConcurrency, Func func)
+{
+    exec::async_scope scope;
+    size_t next = 0;
+    auto workers = std::min(items.size(), std::max<size_t>(maxConcurrency, 1));
+    for (size_t worker = 0; worker < workers; worker++)
+    {
+        scope.spawn(stdexec::just() |
+                        stdexec::let_value([&]() -> exec::task<void> {
+                            while (next < items.size())
+                            {
+                                co_await func(items[next++]);
+                            }
+                        }),
+                    exec::default_task_context<void>(exec::inline_scheduler{}));
+    }
+    co_await scope.on_empty();
+}
+
+} // namespace platform_mc
+} // namespace pldm
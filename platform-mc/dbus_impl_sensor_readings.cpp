@@ -0,0 +1,99 @@
+#include "dbus_impl_sensor_readings.hpp"
+
+#include "terminus.hpp"
+
+#include <xyz/openbmc_project/Common/error.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+namespace pldm
+{
+namespace dbus_api
+{
+
+using InvalidArgument =
+    sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument;
+
+/** @brief Get the offset of CLOCK_REALTIME to CLOCK_MONOTONIC
+ *
+ *  @return milliseconds to add to a CLOCK_MONOTONIC time
+ */
+static int64_t getRealTimeOffset()
+{
+    using namespace std::chrono;
+    auto monotonicNow =
+        duration_cast<milliseconds>(steady_clock::now().time_since_epoch())
+            .count();
+    auto realNow =
+        duration_cast<milliseconds>(system_clock::now().time_since_epoch())
+            .count();
+    return realNow - monotonicNow;
+}
+
+std::vector<SensorReadingRecord> SensorReadings::getSensorReadings(uint8_t tid)
+{
+    auto it = termini.find(tid);
+    if (it == termini.end() || !it->second)
+    {
+        throw InvalidArgument();
+    }
+    const auto& table = it->second->numericSensorTable;
+
+    std::vector<double> values(table.size());
+    table.convert(values);
+    auto offset = getRealTimeOffset();
+
+    std::vector<SensorReadingRecord> records;
+    records.reserve(table.size());
+    for (size_t index = 0; index < table.size(); index++)
+    {
+        // The table times are CLOCK_MONOTONIC microseconds
+        auto time = std::max(table.timeStamps[index], table.eventTimes[index]);
+        uint64_t timeStamp = 0;
+        if (time)
+        {
+            timeStamp = static_cast<uint64_t>(
+                static_cast<int64_t>(time / 1000) + offset);
+        }
+        records.emplace_back(table.sensorIds[index], values[index],
+                             table.statuses[index], timeStamp);
+    }
+    return records;
+}
+
+std::vector<SensorHistoryRecord> SensorReadings::getSensorHistory(
+    uint8_t tid, uint32_t window)
+{
+    auto windowIndex = platform_mc::SensorHistory::findWindow(window);
+    auto it = termini.find(tid);
+    if (!windowIndex || it == termini.end() || !it->second)
+    {
+        throw InvalidArgument();
+    }
+    const auto& terminus = *it->second;
+
+    // The history is kept in CLOCK_MONOTONIC time
+    auto offset = getRealTimeOffset();
+
+    std::vector<SensorHistoryRecord> records;
+    records.reserve(terminus.numericSensorTable.size());
+    for (size_t index = 0; index < terminus.numericSensorTable.size(); index++)
+    {
+        std::vector<SensorHistoryBucket> buckets;
+        for (const auto& bucket :
+             terminus.numericSensorHistory.getBuckets(index, *windowIndex))
+        {
+            auto start = static_cast<int64_t>(bucket.period) * window * 1000;
+            buckets.emplace_back(static_cast<uint64_t>(start + offset),
+                                 bucket.min, bucket.max,
+                                 bucket.sum / bucket.count, bucket.count);
+        }
+        records.emplace_back(terminus.numericSensorTable.sensorIds[index],
+                             std::move(buckets));
+    }
+    return records;
+}
+
+} // namespace dbus_api
+} // namespace pldm
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "pldm/SensorReadings/server.hpp"
+#include "terminus_manager.hpp"
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/object.hpp>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace pldm
+{
+namespace dbus_api
+{
+
+using SensorReadingsIntf =
+    sdbusplus::server::object_t<sdbusplus::pldm::server::SensorReadings>;
+
+/** @brief Reading of a sensor as exposed on D-Bus
+ *
+ *  Sensor ID, value in the sensor units (not a number if not read), bitmask of
+ *  platform_mc::SensorTable::Status and CLOCK_REALTIME milliseconds of the
+ *  reading (0 if not read).
+ */
+using SensorReadingRecord = std::tuple<uint16_t, double, uint8_t, uint64_t>;
+
+/** @brief Aggregate of the readings of a sensor over one window as exposed on
+ *         D-Bus
+ *
+ *  CLOCK_REALTIME milliseconds at the start of the window, minimum, maximum,
+ *  average and number of readings.
+ */
+using SensorHistoryBucket =
+    std::tuple<uint64_t, double, double, double, uint32_t>;
+
+/** @brief History of a sensor as exposed on D-Bus
+ *
+ *  Sensor ID and the windows from the oldest to the newest.
+ */
+using SensorHistoryRecord =
+    std::tuple<uint16_t, std::vector<SensorHistoryBucket>>;
+
+/** @class SensorReadings
+ *  @brief OpenBMC PLDM.SensorReadings Implementation
+ *  @details A concrete implementation for the
+ *  pldm.SensorReadings DBus APIs, defined in
+ *  yaml/pldm/SensorReadings.interface.yaml, exposing the numeric sensors of a
+ *  terminus in bulk.
+ */
+class SensorReadings : public SensorReadingsIntf
+{
+  public:
+    SensorReadings() = delete;
+    SensorReadings(const SensorReadings&) = delete;
+    SensorReadings& operator=(const SensorReadings&) = delete;
+    SensorReadings(SensorReadings&&) = delete;
+    SensorReadings& operator=(SensorReadings&&) = delete;
+    virtual ~SensorReadings() = default;
+
+    /** @brief Constructor to put object onto bus at a dbus path.
+     *  @param[in] bus - Bus to attach to.
+     *  @param[in] path - Path to attach at.
+     *  @param[in] termini - the discovered termini
+     */
+    SensorReadings(sdbusplus::bus_t& bus, const std::string& path,
+                   const platform_mc::TerminiMapper& termini) :
+        SensorReadingsIntf(bus, path.c_str()), termini(termini)
+    {}
+
+    /** @brief Implementation for SensorReadingsIntf.GetSensorHistory
+     *
+     *  @param[in] tid - the terminus
+     *  @param[in] window - the window width in seconds
+     *
+     *  @return the history of each sensor
+     */
+    std::vector<SensorHistoryRecord> getSensorHistory(
+        uint8_t tid, uint32_t window) override;
+
+    /** @brief Implementation for SensorReadingsIntf.GetSensorReadings
+     *
+     *  @param[in] tid - the terminus
+     *
+     *  @return the reading of each sensor
+     */
+    std::vector<SensorReadingRecord> getSensorReadings(uint8_t tid) override;
+
+  private:
+    /** @brief The discovered termini */
+    const platform_mc::TerminiMapper& termini;
+};
+
+} // namespace dbus_api
+} // namespace pldm
@@ -9,6 +9,8 @@
 #include <xyz/openbmc_project/Logging/Entry/server.hpp>
 
 #include <cerrno>
+#include <chrono>
+#include <cstring>
 #include <memory>
 
 PHOSPHOR_LOG2_USING;
@@ -101,11 +103,131 @@ int EventManager::handlePlatformEvent(
         return PLDM_SUCCESS;
     }
 
+    /* EventClass pldmPDRRepositoryChgEvent `Table 11 - PLDM Event Types`
+     * DSP0248 */
+    if (eventClass == PLDM_PDR_REPOSITORY_CHG_EVENT)
+    {
+        return processPdrRepositoryChgEvent(tid, eventData, eventDataSize);
+    }
+
     lg2::info("Unsupported class type {CLASSTYPE}", "CLASSTYPE", eventClass);
 
     return PLDM_ERROR;
 }
 
+int EventManager::processPdrRepositoryChgEvent(
+    pldm_tid_t tid, const uint8_t* eventData, size_t eventDataSize)
+{
+    uint8_t eventDataFormat = 0;
+    uint8_t numberOfChangeRecords = 0;
+    size_t dataOffset = 0;
+    auto rc = decode_pldm_pdr_repository_chg_event_data(
+        eventData, eventDataSize, &eventDataFormat, &numberOfChangeRecords,
+        &dataOffset);
+    if (rc)
+    {
+        lg2::error(
+            "Failed to decode pldmPDRRepositoryChgEvent for terminus ID {TID}, error {RC}",
+            "TID", tid, "RC", rc);
+        return rc;
+    }
+
+    auto it = termini.find(tid);
+    if (it == termini.end() || !it->second)
+    {
+        return PLDM_ERROR;
+    }
+    auto& changes = it->second->pdrChanges;
+
+    /* Only the changes by record handle tell which PDRs changed */
+    if (eventDataFormat != FORMAT_IS_PDR_HANDLES)
+    {
+        lg2::info("Terminus ID {TID} changed its PDR repository.", "TID", tid);
+        changes.refreshAll = true;
+        return PLDM_SUCCESS;
+    }
+
+    auto changeRecordData = eventData + dataOffset;
+    auto changeRecordDataSize = eventDataSize - dataOffset;
+    for (uint8_t record = 0;
+         record < numberOfChangeRecords && changeRecordDataSize; record++)
+    {
+        uint8_t eventDataOperation = 0;
+        uint8_t numberOfChangeEntries = 0;
+        rc = decode_pldm_pdr_repository_change_record_data(
+            changeRecordData, changeRecordDataSize, &eventDataOperation,
+            &numberOfChangeEntries, &dataOffset);
+        if (rc || numberOfChangeEntries > (changeRecordDataSize - dataOffset) /
+                                              sizeof(uint32_t))
+        {
+            lg2::error(
+                "Failed to decode pldmPDRRepositoryChgEvent change record for terminus ID {TID}, error {RC}",
+                "TID", tid, "RC", rc);
+            changes.refreshAll = true;
+            return rc ? rc : PLDM_ERROR_INVALID_DATA;
+        }
+
+        if (eventDataOperation != PLDM_RECORDS_DELETED &&
+            eventDataOperation != PLDM_RECORDS_ADDED &&
+            eventDataOperation != PLDM_RECORDS_MODIFIED)
+        {
+            changes.refreshAll = true;
+        }
+
+        for (uint8_t entry = 0; entry < numberOfChangeEntries; entry++)
+        {
+            uint32_t handle = 0;
+            memcpy(&handle,
+                   changeRecordData + dataOffset + entry * sizeof(handle),
+                   sizeof(handle));
+            handle = le32toh(handle);
+            if (eventDataOperation == PLDM_RECORDS_DELETED)
+            {
+                changes.changedHandles.erase(handle);
+                changes.deletedHandles.insert(handle);
+            }
+            else
+            {
+                changes.deletedHandles.erase(handle);
+                changes.changedHandles.insert(handle);
+            }
+        }
+
+        auto recordSize = dataOffset + numberOfChangeEntries * sizeof(uint32_t);
+        changeRecordData += recordSize;
+        changeRecordDataSize -= recordSize;
+    }
+
+    lg2::info(
+        "Terminus ID {TID} changed {CHANGED} and deleted {DELETED} PDRs.",
+        "TID", tid, "CHANGED", changes.changedHandles.size(), "DELETED",
+        changes.deletedHandles.size());
+
+    return PLDM_SUCCESS;
+}
+
+/** @brief Get the value of a numeric sensor event reading
+ *
+ *  @param[in] sensorDataSize - PLDM sensor data size of the reading
+ *  @param[in] presentReading - the reading decoded from the event
+ *
+ *  @return the reading, sign extended for the signed data sizes
+ */
+static double getEventReading(uint8_t sensorDataSize, uint32_t presentReading)
+{
+    switch (sensorDataSize)
+    {
+        case PLDM_SENSOR_DATA_SIZE_SINT8:
+            return static_cast<int8_t>(presentReading);
+        case PLDM_SENSOR_DATA_SIZE_SINT16:
+            return static_cast<int16_t>(presentReading);
+        case PLDM_SENSOR_DATA_SIZE_SINT32:
+            return static_cast<int32_t>(presentReading);
+        default:
+            return presentReading;
+    }
+}
+
 int EventManager::processNumericSensorEvent(pldm_tid_t tid, uint16_t sensorId,
                                             const uint8_t* sensorData,
                                             size_t sensorDataLength)
@@ -125,7 +247,7 @@ int EventManager::processNumericSensorEvent(pldm_tid_t tid, uint16_t sensorId,
         return rc;
     }
 
-    double value = static_cast<double>(presentReading);
+    double value = getEventReading(sensorDataSize, presentReading);
     lg2::error(
         "processNumericSensorEvent tid {TID}, sensorID {SID} value {VAL} previousState {PSTATE} eventState {ESTATE}",
         "TID", tid, "SID", sensorId, "VAL", value, "PSTATE", previousEventState,
@@ -149,6 +271,21 @@ int EventManager::processNumericSensorEvent(pldm_tid_t tid, uint16_t sensorId,
         return PLDM_ERROR;
     }
 
+    /* The event reading is published and the sensor poller slows down to
+     * the heartbeat interval while the events are flowing */
+    auto& table = terminus->numericSensorTable;
+    if (auto index = table.find(sensorId))
+    {
+        auto now = std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+        table.recordEvent(*index, value, static_cast<uint64_t>(now));
+        terminus->numericSensorHistory.record(*index, sensor->toUnits(value),
+                                              static_cast<uint64_t>(now));
+    }
+    sensor->updateReading(true, true, value);
+    sensor->emitPropertiesChanged();
+
     switch (previousEventState)
     {
         case PLDM_SENSOR_UNKNOWN:
@@ -136,6 +136,19 @@ class EventManager
                                   const uint8_t* sensorData,
                                   size_t sensorDataLength);
 
+    /** @brief Helper method to process the PLDM PDR Repository Change event
+     *         class. The changes are recorded in the terminus and applied by
+     *         the sensor polling.
+     *
+     *  @param[in] tid - tid where the event is from
+     *  @param[in] eventData - pldmPDRRepositoryChgEvent event data
+     *  @param[in] eventDataSize - event data length
+     *
+     *  @return PLDM completion code
+     */
+    int processPdrRepositoryChgEvent(pldm_tid_t tid, const uint8_t* eventData,
+                                     size_t eventDataSize);
+
     /** @brief Helper method to process the PLDM CPER event class
      *
      *  @param[in] tid - tid where the event is from
@@ -199,6 +199,39 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
         return PLDM_SUCCESS;
     }
 
+    /** @brief PLDM PDR Repository Change event handler function
+     *
+     *  @param[in] request - Event message
+     *  @param[in] payloadLength - Event message payload size
+     *  @param[in] tid - Terminus ID
+     *  @param[in] eventDataOffset - Event data offset
+     *
+     *  @return PLDM error code: PLDM_SUCCESS when there is no error in handling
+     *          the event
+     */
+    int handlePdrRepositoryChgEvent(
+        const pldm_msg* request, size_t payloadLength,
+        uint8_t /* formatVersion */, uint8_t tid, size_t eventDataOffset)
+    {
+        auto eventData = reinterpret_cast<const uint8_t*>(request->payload) +
+                         eventDataOffset;
+        auto eventDataSize = payloadLength - eventDataOffset;
+        eventManager.handlePlatformEvent(tid, PLDM_PLATFORM_EVENT_ID_NULL,
+                                         PLDM_PDR_REPOSITORY_CHG_EVENT,
+                                         eventData, eventDataSize);
+        return PLDM_SUCCESS;
+    }
+
+    /** @brief Apply the PDR repository changes signaled by a terminus
+     *
+     *  @param[in] tid - Terminus ID
+     *  @return coroutine return_value - PLDM completion code
+     */
+    exec::task<int> updatePDRs(pldm_tid_t tid)
+    {
+        return platformManager.updatePDRs(tid);
+    }
+
     /** @brief The function to trigger the event polling
      *
      *  @param[in] tid - Terminus ID
@@ -266,6 +299,15 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
         return terminusManager.getActiveEidByName(terminusName);
     }
 
+    /** @brief Get the discovered termini
+     *
+     *  @return the termini keyed by TID
+     */
+    const TerminiMapper& getTermini() const
+    {
+        return termini;
+    }
+
   private:
     /** @brief List of discovered termini */
     TerminiMapper termini{};
@@ -251,7 +251,7 @@ NumericSensor::NumericSensor(
     resolution = pdr->resolution;
     offset = pdr->offset;
     baseUnitModifier = pdr->unit_modifier;
-    timeStamp = 0;
+    initConversion();
 
     /**
      * DEFAULT_SENSOR_UPDATER_INTERVAL is in milliseconds
@@ -277,8 +277,8 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        valueIntf->maxValue(unitModifier(conversionFormula(maxValue)));
-        valueIntf->minValue(unitModifier(conversionFormula(minValue)));
+        valueIntf->maxValue(toUnits(maxValue));
+        valueIntf->minValue(toUnits(minValue));
         valueIntf->unit(sensorUnit);
     }
     else
@@ -295,12 +295,17 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        metricIntf->maxValue(unitModifier(conversionFormula(maxValue)));
-        metricIntf->minValue(unitModifier(conversionFormula(minValue)));
+        metricIntf->maxValue(toUnits(maxValue));
+        metricIntf->minValue(toUnits(minValue));
         metricIntf->unit(metricUnit);
     }
 
-    hysteresis = unitModifier(conversionFormula(hysteresis));
+    hysteresis = toUnits(hysteresis);
+
+    /* SENSOR_VALUE_DEADBAND is in thousandths of the reading range */
+    setValueDeadband((toUnits(maxValue) - toUnits(minValue)) *
+                     SENSOR_VALUE_DEADBAND / 1000);
+    setThresholdMargin((toUnits(maxValue) - toUnits(minValue)) / 20);
 
     if (!createInventoryPath(associationPath, sensorName, pdr->entity_type,
                              pdr->entity_instance_num, pdr->container_id))
@@ -465,7 +470,7 @@ NumericSensor::NumericSensor(
     resolution = std::numeric_limits<double>::quiet_NaN();
     offset = std::numeric_limits<double>::quiet_NaN();
     baseUnitModifier = pdr->unit_modifier;
-    timeStamp = 0;
+    initConversion();
     hysteresis = 0;
 
     /**
@@ -488,8 +493,8 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        valueIntf->maxValue(unitModifier(conversionFormula(maxValue)));
-        valueIntf->minValue(unitModifier(conversionFormula(minValue)));
+        valueIntf->maxValue(toUnits(maxValue));
+        valueIntf->minValue(toUnits(minValue));
         valueIntf->unit(sensorUnit);
     }
     else
@@ -506,12 +511,17 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        metricIntf->maxValue(unitModifier(conversionFormula(maxValue)));
-        metricIntf->minValue(unitModifier(conversionFormula(minValue)));
+        metricIntf->maxValue(toUnits(maxValue));
+        metricIntf->minValue(toUnits(minValue));
         metricIntf->unit(metricUnit);
     }
 
-    hysteresis = unitModifier(conversionFormula(hysteresis));
+    hysteresis = toUnits(hysteresis);
+
+    /* SENSOR_VALUE_DEADBAND is in thousandths of the reading range */
+    setValueDeadband((toUnits(maxValue) - toUnits(minValue)) *
+                     SENSOR_VALUE_DEADBAND / 1000);
+    setThresholdMargin((toUnits(maxValue) - toUnits(minValue)) / 20);
 
     if (!createInventoryPath(associationPath, sensorName, pdr->entity_type,
                              pdr->entity_instance, pdr->container_id))
@@ -586,27 +596,24 @@ NumericSensor::NumericSensor(
     }
 }
 
+void NumericSensor::initConversion()
+{
+    /* A resolution or an offset which is not a number is not applied */
+    conversion.resolution = std::isfinite(resolution) ? resolution : 1;
+    conversion.offset = std::isfinite(offset) ? offset : 0;
+    conversion.unitScale = std::pow(10, baseUnitModifier);
+    conversion.scale = conversion.resolution * conversion.unitScale;
+    conversion.bias = conversion.offset * conversion.unitScale;
+}
+
 double NumericSensor::conversionFormula(double value)
 {
-    double convertedValue = value;
-    if (std::isfinite(resolution))
-    {
-        convertedValue *= resolution;
-    }
-    if (std::isfinite(offset))
-    {
-        convertedValue += offset;
-    }
-    return convertedValue;
+    return value * conversion.resolution + conversion.offset;
 }
 
 double NumericSensor::unitModifier(double value)
 {
-    if (!std::isfinite(value))
-    {
-        return value;
-    }
-    return value * std::pow(10, baseUnitModifier);
+    return value * conversion.unitScale;
 }
 
 void NumericSensor::updateReading(bool available, bool functional, double value)
@@ -620,8 +627,16 @@ void NumericSensor::updateReading(bool available, bool functional, double value)
             "NAME", sensorName);
         return;
     }
-    availabilityIntf->available(available);
-    operationalStatusIntf->functional(functional);
+    if (availabilityIntf->available() != available)
+    {
+        availabilityIntf->available(available, true);
+        pendingSignals |= pendingAvailable;
+    }
+    if (operationalStatusIntf->functional() != functional)
+    {
+        operationalStatusIntf->functional(functional, true);
+        pendingSignals |= pendingFunctional;
+    }
     double curValue = 0;
     if (!useMetricInterface)
     {
@@ -635,36 +650,68 @@ void NumericSensor::updateReading(bool available, bool functional, double value)
     double newValue = std::numeric_limits<double>::quiet_NaN();
     if (functional && available)
     {
-        newValue = unitModifier(conversionFormula(value));
-        if (newValue != curValue &&
-            (std::isfinite(newValue) || std::isfinite(curValue)))
-        {
-            if (!useMetricInterface)
-            {
-                valueIntf->value(newValue);
-                updateThresholds();
-            }
-            else
-            {
-                metricIntf->value(newValue);
-            }
-        }
+        newValue = toUnits(value);
+    }
+    if (newValue == curValue ||
+        (!std::isfinite(newValue) && !std::isfinite(curValue)))
+    {
+        return;
+    }
+
+    /* The thresholds are checked against every reading, the deadband only
+     * limits how often the value is published */
+    bool alarmChanged = false;
+    if (!useMetricInterface && std::isfinite(newValue))
+    {
+        alarmChanged = updateThresholds(newValue);
+    }
+    if (!alarmChanged && std::isfinite(newValue) && std::isfinite(curValue) &&
+        std::abs(newValue - curValue) < valueDeadband)
+    {
+        return;
+    }
+
+    if (!useMetricInterface)
+    {
+        valueIntf->value(newValue, true);
     }
     else
     {
-        if (newValue != curValue &&
-            (std::isfinite(newValue) || std::isfinite(curValue)))
+        metricIntf->value(newValue, true);
+    }
+    pendingSignals |= pendingValue;
+}
+
+void NumericSensor::emitPropertiesChanged()
+{
+    if (!pendingSignals)
+    {
+        return;
+    }
+
+    auto& bus = pldm::utils::DBusHandler::getBus();
+    auto path = sensorNameSpace + sensorName;
+    auto emit = [&](PendingSignal signal, const char* interface,
+                    const char* property) {
+        if (!(pendingSignals & signal))
         {
-            if (!useMetricInterface)
-            {
-                valueIntf->value(std::numeric_limits<double>::quiet_NaN());
-            }
-            else
-            {
-                metricIntf->value(std::numeric_limits<double>::quiet_NaN());
-            }
+            return;
         }
-    }
+        auto rc = sd_bus_emit_properties_changed(bus.get(), path.c_str(),
+                                                 interface, property, nullptr);
+        if (rc < 0)
+        {
+            lg2::error(
+                "Failed to emit {PROPERTY} changed for sensor {NAME}, error {RC}",
+                "PROPERTY", property, "NAME", sensorName, "RC", rc);
+        }
+    };
+
+    emit(pendingAvailable, AvailabilityIntf::interface, "Available");
+    emit(pendingFunctional, OperationalStatusIntf::interface, "Functional");
+    emit(pendingValue,
+         useMetricInterface ? METRIC_VALUE_INTF : SENSOR_VALUE_INTF, "Value");
+    pendingSignals = 0;
 }
 
 void NumericSensor::handleErrGetSensorReading()
@@ -677,14 +724,20 @@ void NumericSensor::handleErrGetSensorReading()
             "NAME", sensorName);
         return;
     }
-    operationalStatusIntf->functional(false);
-    if (!useMetricInterface)
+    if (operationalStatusIntf->functional())
     {
-        valueIntf->value(std::numeric_limits<double>::quiet_NaN());
+        operationalStatusIntf->functional(false, true);
+        pendingSignals |= pendingFunctional;
     }
-    else
+    if (!useMetricInterface && std::isfinite(valueIntf->value()))
     {
-        metricIntf->value(std::numeric_limits<double>::quiet_NaN());
+        valueIntf->value(std::numeric_limits<double>::quiet_NaN(), true);
+        pendingSignals |= pendingValue;
+    }
+    else if (useMetricInterface && std::isfinite(metricIntf->value()))
+    {
+        metricIntf->value(std::numeric_limits<double>::quiet_NaN(), true);
+        pendingSignals |= pendingValue;
     }
 }
 
@@ -716,26 +769,30 @@ bool NumericSensor::checkThreshold(bool alarm, bool direction, double value,
     return alarm;
 }
 
-void NumericSensor::updateThresholds()
+bool NumericSensor::isSteady(double start, double value)
 {
-    double value = std::numeric_limits<double>::quiet_NaN();
-
-    if ((!useMetricInterface && !valueIntf) ||
-        (useMetricInterface && !metricIntf))
-    {
-        lg2::error(
-            "Failed to update thresholds sensor {NAME} D-Bus interfaces don't exist.",
-            "NAME", sensorName);
-        return;
-    }
-    if (!useMetricInterface)
+    if (!std::isfinite(start) || !std::isfinite(value) ||
+        std::abs(value - start) > std::max(hysteresis, valueDeadband))
     {
-        value = valueIntf->value();
+        return false;
     }
-    else
+
+    for (auto threshold :
+         {getThresholdUpperWarning(), getThresholdLowerWarning(),
+          getThresholdUpperCritical(), getThresholdLowerCritical()})
     {
-        value = metricIntf->value();
+        if (std::isfinite(threshold) &&
+            std::abs(value - threshold) <= thresholdMargin)
+        {
+            return false;
+        }
     }
+    return true;
+}
+
+bool NumericSensor::updateThresholds(double value)
+{
+    bool alarmChanged = false;
     if (thresholdWarningIntf &&
         std::isfinite(thresholdWarningIntf->warningHigh()))
     {
@@ -745,6 +802,7 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, true, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
+            alarmChanged = true;
             thresholdWarningIntf->warningAlarmHigh(newAlarm);
             if (newAlarm)
             {
@@ -766,6 +824,7 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, false, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
+            alarmChanged = true;
             thresholdWarningIntf->warningAlarmLow(newAlarm);
             if (newAlarm)
             {
@@ -787,6 +846,7 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, true, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
+            alarmChanged = true;
             thresholdCriticalIntf->criticalAlarmHigh(newAlarm);
             if (newAlarm)
             {
@@ -808,6 +868,7 @@ void NumericSensor::updateThresholds()
             checkThreshold(alarm, false, value, threshold, hysteresis);
         if (alarm != newAlarm)
         {
+            alarmChanged = true;
             thresholdCriticalIntf->criticalAlarmLow(newAlarm);
             if (newAlarm)
             {
@@ -819,6 +880,8 @@ void NumericSensor::updateThresholds()
             }
         }
     }
+
+    return alarmChanged;
 }
 
 int NumericSensor::triggerThresholdEvent(
@@ -833,7 +896,7 @@ int NumericSensor::triggerThresholdEvent(
         return PLDM_ERROR;
     }
 
-    auto value = unitModifier(conversionFormula(rawValue));
+    auto value = toUnits(rawValue);
     lg2::error(
         "triggerThresholdEvent eventType {TID}, direction {SID} value {VAL} newAlarm {PSTATE} assert {ESTATE}",
         "TID", eventType, "SID", direction, "VAL", value, "PSTATE", newAlarm,
@@ -16,6 +16,9 @@
 #include <xyz/openbmc_project/State/Decorator/Availability/server.hpp>
 #include <xyz/openbmc_project/State/Decorator/OperationalStatus/server.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <span>
 #include <string>
 
 namespace pldm
@@ -46,6 +49,44 @@ using AssociationDefinitionsInft = sdbusplus::server::object_t<
 using EntityIntf = sdbusplus::server::object_t<
     sdbusplus::xyz::openbmc_project::Inventory::Source::PLDM::server::Entity>;
 
+/** @struct SensorConversion
+ *
+ *  The conversion of the raw readings of a sensor to its unit, derived once
+ *  from the PDR resolution, offset and unit modifier.
+ */
+struct SensorConversion
+{
+    double resolution = 1; //!< PDR resolution, 1 if not a number
+    double offset = 0;     //!< PDR offset, 0 if not a number
+    double unitScale = 1;  //!< 10 to the power of the PDR unit modifier
+    double scale = 1;      //!< resolution * unitScale
+    double bias = 0;       //!< offset * unitScale
+};
+
+/** @brief Convert raw readings to the units of their sensors
+ *
+ *  The conversions are passed as separate arrays of scales and biases so
+ *  the loop is a single fused multiply-add per reading which the compiler
+ *  can vectorize.
+ *
+ *  @param[in] raw - raw readings
+ *  @param[in] scales - SensorConversion::scale of the sensor of each reading
+ *  @param[in] biases - SensorConversion::bias of the sensor of each reading
+ *  @param[out] values - converted readings
+ */
+inline void convertReadings(std::span<const double> raw,
+                            std::span<const double> scales,
+                            std::span<const double> biases,
+                            std::span<double> values)
+{
+    auto size =
+        std::min({raw.size(), scales.size(), biases.size(), values.size()});
+    for (size_t i = 0; i < size; i++)
+    {
+        values[i] = std::fma(raw[i], scales[i], biases[i]);
+    }
+}
+
 /**
  * @brief NumericSensor
  *
@@ -71,9 +112,58 @@ class NumericSensor
     void handleErrGetSensorReading();
 
     /** @brief Updating the sensor status to D-Bus interface
+     *
+     *  The properties are updated without signals, emitPropertiesChanged
+     *  emits the changes. A value within the deadband of the published value
+     *  is not published unless a threshold alarm changed.
      */
     void updateReading(bool available, bool functional, double value = 0);
 
+    /** @brief Emit one PropertiesChanged signal for each interface with
+     *         properties updated since the last call
+     */
+    void emitPropertiesChanged();
+
+    /** @brief Check if properties were updated without signals
+     *
+     *  @return true if emitPropertiesChanged has signals to emit
+     */
+    bool hasPendingSignals() const
+    {
+        return pendingSignals != 0;
+    }
+
+    /** @brief Set the smallest change of value published to D-Bus
+     *
+     *  @param[in] deadband - the change of value in the sensor unit
+     */
+    void setValueDeadband(double deadband)
+    {
+        valueDeadband = std::isfinite(deadband) ? std::abs(deadband) : 0;
+    }
+
+    /** @brief Set the distance to a threshold the readings are not steady
+     *         within
+     *
+     *  @param[in] margin - the distance in the sensor unit
+     */
+    void setThresholdMargin(double margin)
+    {
+        thresholdMargin = std::isfinite(margin) ? std::abs(margin) : 0;
+    }
+
+    /** @brief Check if a sensor reading is steady, for the adaptive polling
+     *
+     *  @param[in] start - reading which started the steady run in the
+     *                     sensor unit
+     *  @param[in] value - new reading in the sensor unit
+     *
+     *  @return true if the reading differs from the start of the run by
+     *          less than the hysteresis and the deadband and is not near a
+     *          threshold
+     */
+    bool isSteady(double start, double value);
+
     /** @brief ConversionFormula is used to convert raw value to the unit
      * specified in PDR
      *
@@ -89,6 +179,26 @@ class NumericSensor
      */
     double unitModifier(double value);
 
+    /** @brief Convert a raw value to the sensor unit, the same as
+     *         unitModifier(conversionFormula(value))
+     *
+     *  @param[in] value - raw value
+     *  @return double - converted value
+     */
+    double toUnits(double value) const
+    {
+        return std::fma(value, conversion.scale, conversion.bias);
+    }
+
+    /** @brief Get the conversion of the raw readings to the sensor unit
+     *
+     *  @return the conversion coefficients
+     */
+    const SensorConversion& getConversion() const
+    {
+        return conversion;
+    }
+
     /** @brief Check if value is over threshold.
      *
      *  @param[in] alarm - previous alarm state
@@ -197,9 +307,6 @@ class NumericSensor
     /** @brief Sensor ID */
     uint16_t sensorId;
 
-    /** @brief  The time stamp since last getSensorReading command in usec */
-    uint64_t timeStamp;
-
     /** @brief  The time of sensor update interval in usec */
     uint64_t updateTime;
 
@@ -216,8 +323,18 @@ class NumericSensor
     /**
      * @brief Check sensor reading if any threshold has been crossed and update
      * Threshold interfaces accordingly
+     *
+     * @param[in] value - the sensor reading in the sensor unit
+     *
+     * @return true if a threshold alarm changed
+     */
+    bool updateThresholds(double value);
+
+    /**
+     * @brief Derive the conversion coefficients from the resolution, offset
+     * and unit modifier
      */
-    void updateThresholds();
+    void initConversion();
 
     /**
      * @brief Update the object units based on the PDR baseUnit
@@ -261,7 +378,28 @@ class NumericSensor
 
     /** @brief A power-of-10 multiplier for baseUnit */
     int8_t baseUnitModifier;
+
+    /** @brief Conversion of the raw readings derived from the PDR */
+    SensorConversion conversion;
     bool useMetricInterface = false;
+
+    /** @brief Smallest change of value published to D-Bus in Units */
+    double valueDeadband = 0;
+
+    /** @brief Distance to a threshold the readings are not steady within, in
+     *         Units */
+    double thresholdMargin = 0;
+
+    /** @brief Properties updated without signals */
+    enum PendingSignal : uint8_t
+    {
+        pendingAvailable = 1 << 0,
+        pendingFunctional = 1 << 1,
+        pendingValue = 1 << 2,
+    };
+
+    /** @brief Bitmask of PendingSignal */
+    uint8_t pendingSignals = 0;
 };
 } // namespace platform_mc
 } // namespace pldm
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/**
+ * @brief PdrArena
+ *
+ * The PDRs of a terminus stored back to back in one buffer with the offset
+ * of each PDR, instead of one allocation per PDR. The PDRs are accessed as
+ * spans, which adding or removing PDRs invalidates.
+ */
+class PdrArena
+{
+  public:
+    /** @brief Iterator over the PDRs as spans */
+    class Iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::span<const uint8_t>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        Iterator() = default;
+        Iterator(const PdrArena* arena, size_t index) :
+            arena(arena), index(index)
+        {}
+
+        value_type operator*() const
+        {
+            return (*arena)[index];
+        }
+
+        Iterator& operator++()
+        {
+            index++;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto it = *this;
+            index++;
+            return it;
+        }
+
+        bool operator==(const Iterator&) const = default;
+
+      private:
+        const PdrArena* arena = nullptr; //!< the iterated arena
+        size_t index = 0;                //!< index of the PDR
+    };
+
+    /** @brief Get the number of PDRs */
+    size_t size() const
+    {
+        return offsets.size();
+    }
+
+    /** @brief Check if there is no PDR */
+    bool empty() const
+    {
+        return offsets.empty();
+    }
+
+    /** @brief Get the total size of the PDRs in bytes */
+    size_t bytes() const
+    {
+        return data.size();
+    }
+
+    /** @brief Remove all the PDRs */
+    void clear()
+    {
+        data.clear();
+        offsets.clear();
+    }
+
+    /** @brief Reserve memory for PDRs
+     *
+     *  @param[in] numPdrs - number of PDRs
+     *  @param[in] numBytes - total size of the PDRs in bytes
+     */
+    void reserve(size_t numPdrs, size_t numBytes)
+    {
+        offsets.reserve(numPdrs);
+        data.reserve(numBytes);
+    }
+
+    /** @brief Add a PDR to fill
+     *
+     *  @param[in] length - size of the PDR in bytes
+     *
+     *  @return the bytes of the PDR
+     */
+    std::span<uint8_t> append(size_t length)
+    {
+        offsets.emplace_back(data.size());
+        data.resize(data.size() + length);
+        return std::span(data).last(length);
+    }
+
+    /** @brief Add a copy of a PDR
+     *
+     *  @param[in] pdr - the PDR, not stored in this arena
+     */
+    void emplace_back(std::span<const uint8_t> pdr)
+    {
+        std::ranges::copy(pdr, append(pdr.size()).begin());
+    }
+
+    /** @brief Get a PDR
+     *
+     *  @param[in] index - index of the PDR
+     *
+     *  @return the bytes of the PDR
+     */
+    std::span<const uint8_t> operator[](size_t index) const
+    {
+        auto end = (index + 1 < offsets.size()) ? offsets[index + 1]
+                                                : data.size();
+        return std::span(data).subspan(offsets[index], end - offsets[index]);
+    }
+
+    /** @brief Get the last PDR */
+    std::span<const uint8_t> back() const
+    {
+        return (*this)[size() - 1];
+    }
+
+    Iterator begin() const
+    {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() const
+    {
+        return Iterator(this, size());
+    }
+
+    /** @brief Remove the PDRs matching a predicate, keeping the order of the
+     *         other PDRs
+     *
+     *  @param[in] pred - called with each PDR, returns true to remove it
+     *
+     *  @return number of removed PDRs
+     */
+    template <typename Pred>
+    size_t eraseIf(Pred pred)
+    {
+        size_t kept = 0;
+        size_t keptBytes = 0;
+        auto count = size();
+        for (size_t index = 0; index < count; index++)
+        {
+            auto pdr = (*this)[index];
+            if (pred(pdr))
+            {
+                continue;
+            }
+            auto first = data.begin() + offsets[index];
+            std::copy(first, first + pdr.size(), data.begin() + keptBytes);
+            offsets[kept++] = keptBytes;
+            keptBytes += pdr.size();
+        }
+        offsets.resize(kept);
+        data.resize(keptBytes);
+        return count - kept;
+    }
+
+    bool operator==(const PdrArena&) const = default;
+
+  private:
+    /** @brief The PDRs back to back */
+    std::vector<uint8_t> data;
+
+    /** @brief Offset of each PDR in data, a PDR ends at the next offset */
+    std::vector<size_t> offsets;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -0,0 +1,220 @@
+#include "pdr_cache.hpp"
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <cctype>
+#include <fstream>
+#include <ranges>
+#include <system_error>
+#include <vector>
+
+PHOSPHOR_LOG2_USING;
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @brief Magic at the start of a PDR cache file */
+constexpr std::array<char, 8> pdrCacheMagic = {'P', 'L', 'D', 'M',
+                                               'P', 'D', 'R', 'C'};
+
+/** @brief Version of the PDR cache file format */
+constexpr uint16_t pdrCacheVersion = 1;
+
+/** @struct PdrCacheHeader
+ *
+ *  Header of a PDR cache file, followed by numRecords records each made of a
+ *  uint32_t length and the PDR bytes. The fields are in host byte order.
+ */
+struct __attribute__((packed)) PdrCacheHeader
+{
+    std::array<char, 8> magic; //!< pdrCacheMagic
+    uint16_t version;          //!< pdrCacheVersion
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime;    //!< signature
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> oemUpdateTime; //!< signature
+    uint32_t recordCount;       //!< signature
+    uint32_t repositorySize;    //!< signature
+    uint32_t largestRecordSize; //!< signature
+    uint32_t numRecords;        //!< number of cached PDRs
+};
+
+std::optional<std::filesystem::path> PdrCache::getPath(const UUID& uuid) const
+{
+    if (dir.empty() || uuid.empty() ||
+        !std::ranges::all_of(uuid, [](unsigned char c) {
+            return std::isxdigit(c) || c == '-';
+        }))
+    {
+        return std::nullopt;
+    }
+    return dir / uuid;
+}
+
+std::optional<PdrArena> PdrCache::load(
+    const UUID& uuid, const PdrRepositorySignature& signature) const
+{
+    auto path = getPath(uuid);
+    if (!path || !signature.isValid())
+    {
+        return std::nullopt;
+    }
+
+    std::ifstream file(*path, std::ios::binary);
+    if (!file)
+    {
+        return std::nullopt;
+    }
+
+    PdrCacheHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != pdrCacheMagic || header.version != pdrCacheVersion)
+    {
+        lg2::error("Removing invalid PDR cache file {PATH}", "PATH",
+                   path->string());
+        remove(uuid);
+        return std::nullopt;
+    }
+
+    PdrRepositorySignature cached{header.updateTime, header.oemUpdateTime,
+                                  header.recordCount, header.repositorySize,
+                                  header.largestRecordSize};
+    if (cached != signature)
+    {
+        lg2::info("PDR repository of terminus {UUID} changed", "UUID", uuid);
+        return std::nullopt;
+    }
+
+    PdrArena pdrs;
+    pdrs.reserve(header.numRecords, signature.repositorySize);
+    for (uint32_t i = 0; i < header.numRecords; i++)
+    {
+        uint32_t length = 0;
+        if (!file.read(reinterpret_cast<char*>(&length), sizeof(length)) ||
+            length > signature.largestRecordSize)
+        {
+            lg2::error("Removing truncated PDR cache file {PATH}", "PATH",
+                       path->string());
+            remove(uuid);
+            return std::nullopt;
+        }
+        auto pdr = pdrs.append(length);
+        if (!file.read(reinterpret_cast<char*>(pdr.data()), length))
+        {
+            lg2::error("Removing truncated PDR cache file {PATH}", "PATH",
+                       path->string());
+            remove(uuid);
+            return std::nullopt;
+        }
+    }
+
+    // Keep the recently used files when the cache is pruned
+    std::error_code ec;
+    std::filesystem::last_write_time(
+        *path, std::filesystem::file_time_type::clock::now(), ec);
+    return pdrs;
+}
+
+void PdrCache::store(const UUID& uuid, const PdrRepositorySignature& signature,
+                     const PdrArena& pdrs) const
+{
+    auto path = getPath(uuid);
+    if (!path || !signature.isValid())
+    {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec)
+    {
+        lg2::error("Failed to create PDR cache directory {PATH}, error {ERROR}",
+                   "PATH", dir.string(), "ERROR", ec.message());
+        return;
+    }
+
+    // Write a temporary file renamed over the cache file, so a reboot while
+    // writing leaves either the old or the new file
+    auto tmpPath = *path;
+    tmpPath += ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        PdrCacheHeader header{pdrCacheMagic,
+                              pdrCacheVersion,
+                              signature.updateTime,
+                              signature.oemUpdateTime,
+                              signature.recordCount,
+                              signature.repositorySize,
+                              signature.largestRecordSize,
+                              static_cast<uint32_t>(pdrs.size())};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (auto pdr : pdrs)
+        {
+            auto length = static_cast<uint32_t>(pdr.size());
+            file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            file.write(reinterpret_cast<const char*>(pdr.data()), pdr.size());
+        }
+        file.close();
+        if (!file)
+        {
+            lg2::error("Failed to write PDR cache file {PATH}", "PATH",
+                       tmpPath.string());
+            std::filesystem::remove(tmpPath, ec);
+            return;
+        }
+    }
+
+    std::filesystem::rename(tmpPath, *path, ec);
+    if (ec)
+    {
+        lg2::error("Failed to write PDR cache file {PATH}, error {ERROR}",
+                   "PATH", path->string(), "ERROR", ec.message());
+        std::filesystem::remove(tmpPath, ec);
+        return;
+    }
+
+    prune(*path);
+}
+
+void PdrCache::prune(const std::filesystem::path& keep) const
+{
+    std::error_code ec;
+    std::vector<std::pair<std::filesystem::file_time_type,
+                          std::filesystem::path>>
+        files;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec))
+    {
+        if (entry.is_regular_file(ec) && entry.path() != keep)
+        {
+            files.emplace_back(entry.last_write_time(ec), entry.path());
+        }
+    }
+
+    // The stored file is not counted in files
+    if (files.size() < maxFiles)
+    {
+        return;
+    }
+
+    std::ranges::sort(files);
+    auto count = files.size() - (maxFiles - 1);
+    for (const auto& [time, path] : files | std::views::take(count))
+    {
+        lg2::info("Removing unused PDR cache file {PATH}", "PATH",
+                  path.string());
+        std::filesystem::remove(path, ec);
+    }
+}
+
+void PdrCache::remove(const UUID& uuid) const
+{
+    auto path = getPath(uuid);
+    if (path)
+    {
+        std::error_code ec;
+        std::filesystem::remove(*path, ec);
+    }
+}
+
+} // namespace platform_mc
+} // namespace pldm
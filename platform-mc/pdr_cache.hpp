@@ -0,0 +1,129 @@
+#pragma once
+
+#include "common/types.hpp"
+#include "pdr_arena.hpp"
+
+#include <libpldm/platform.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <utility>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @struct PdrRepositorySignature
+ *
+ *  The GetPDRRepositoryInfo fields which change with the content of the PDR
+ *  repository of a terminus.
+ */
+struct PdrRepositorySignature
+{
+    /** @brief UpdateTime */
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime{};
+
+    /** @brief OEMUpdateTime */
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> oemUpdateTime{};
+
+    uint32_t recordCount = 0;       //!< RecordCount
+    uint32_t repositorySize = 0;    //!< RepositorySize
+    uint32_t largestRecordSize = 0; //!< LargestRecordSize
+
+    bool operator==(const PdrRepositorySignature&) const = default;
+
+    /** @brief Check if the signature identifies the repository content
+     *
+     *  @return true if the terminus reports an update time, without which
+     *          a change of the repository keeping its sizes goes unnoticed
+     */
+    bool isValid() const
+    {
+        auto isSet = [](const auto& time) {
+            return std::ranges::any_of(time, [](uint8_t b) { return b != 0; });
+        };
+        return isSet(updateTime) || isSet(oemUpdateTime);
+    }
+};
+
+/**
+ * @brief PdrCache
+ *
+ * Keeps the PDRs fetched from the termini on persistent storage, one file per
+ * terminus named after its MCTP UUID. A file is only used while the terminus
+ * reports the same PDR repository signature as when it was stored, so a BMC
+ * reboot does not download the unchanged repositories again.
+ */
+class PdrCache
+{
+  public:
+    /** @brief Constructor
+     *
+     *  @param[in] dir - directory of the cache files, empty disables the
+     *                   cache
+     *  @param[in] maxFiles - maximum number of cache files, the least
+     *                        recently used files are removed beyond it
+     */
+    explicit PdrCache(std::filesystem::path dir = PDR_CACHE_DIR,
+                      size_t maxFiles = PDR_CACHE_MAX_FILES) :
+        dir(std::move(dir)), maxFiles(std::max<size_t>(maxFiles, 1))
+    {}
+
+    /** @brief Load the cached PDRs of a terminus
+     *
+     *  @param[in] uuid - MCTP UUID of the terminus
+     *  @param[in] signature - current signature of the terminus repository
+     *
+     *  @return the PDRs, std::nullopt if not cached or the repository changed
+     */
+    std::optional<PdrArena> load(const UUID& uuid,
+                                 const PdrRepositorySignature& signature) const;
+
+    /** @brief Cache the PDRs of a terminus
+     *
+     *  @param[in] uuid - MCTP UUID of the terminus
+     *  @param[in] signature - signature of the terminus repository
+     *  @param[in] pdrs - the PDRs fetched from the terminus
+     */
+    void store(const UUID& uuid, const PdrRepositorySignature& signature,
+               const PdrArena& pdrs) const;
+
+    /** @brief Remove the cached PDRs of a terminus
+     *
+     *  @param[in] uuid - MCTP UUID of the terminus
+     */
+    void remove(const UUID& uuid) const;
+
+  private:
+    /** @brief Get the cache file of a terminus
+     *
+     *  @param[in] uuid - MCTP UUID of the terminus
+     *
+     *  @return the path, std::nullopt if the cache is disabled or the UUID is
+     *          not usable as a file name
+     */
+    std::optional<std::filesystem::path> getPath(const UUID& uuid) const;
+
+    /** @brief Remove the least recently used cache files beyond maxFiles
+     *
+     *  The termini replaced or removed from the platform leave their files
+     *  behind, so the directory would otherwise grow without bound.
+     *
+     *  @param[in] keep - the file just stored, which is never removed
+     */
+    void prune(const std::filesystem::path& keep) const;
+
+    /** @brief Directory of the cache files */
+    std::filesystem::path dir;
+
+    /** @brief Maximum number of cache files */
+    size_t maxFiles;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -1,12 +1,17 @@
 #include "platform_manager.hpp"
 
 #include "common/utils.hpp"
+#include "concurrency.hpp"
 #include "manager.hpp"
 #include "terminus_manager.hpp"
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <ranges>
+#include <utility>
 
 PHOSPHOR_LOG2_USING;
 
@@ -17,131 +22,146 @@ namespace platform_mc
 
 exec::task<int> PlatformManager::initTerminus()
 {
-    for (auto& [tid, terminus] : termini)
+    std::vector<pldm_tid_t> tids;
+    for (const auto& [tid, terminus] : termini)
     {
-        if (terminus->initialized)
+        if (terminus && !terminus->initialized)
         {
-            continue;
+            tids.emplace_back(tid);
         }
+    }
 
-        /* Get Fru */
-        uint16_t totalTableRecords = 0;
-        if (terminus->doesSupportCommand(PLDM_FRU,
-                                         PLDM_GET_FRU_RECORD_TABLE_METADATA))
-        {
-            auto rc =
-                co_await getFRURecordTableMetadata(tid, &totalTableRecords);
-            if (rc)
-            {
-                lg2::error(
-                    "Failed to get FRU Metadata for terminus {TID}, error {ERROR}",
-                    "TID", tid, "ERROR", rc);
-            }
-            if (!totalTableRecords)
-            {
-                lg2::info("Fru record table meta data has 0 records");
-            }
-        }
+    /* The termini are independent, initialize them concurrently */
+    co_await forEachConcurrently(
+        tids, TERMINUS_INIT_MAX_CONCURRENCY,
+        [this](pldm_tid_t tid) { return initTerminus(tid); });
 
-        std::vector<uint8_t> fruData{};
-        if ((totalTableRecords != 0) &&
-            terminus->doesSupportCommand(PLDM_FRU, PLDM_GET_FRU_RECORD_TABLE))
-        {
-            auto rc =
-                co_await getFRURecordTables(tid, totalTableRecords, fruData);
-            if (rc)
-            {
-                lg2::error(
-                    "Failed to get Fru Record table for terminus {TID}, error {ERROR}",
-                    "TID", tid, "ERROR", rc);
-            }
-        }
-
-        if (terminus->doesSupportCommand(PLDM_PLATFORM, PLDM_GET_PDR))
-        {
-            auto rc = co_await getPDRs(terminus);
-            if (rc)
-            {
-                lg2::error(
-                    "Failed to fetch PDRs for terminus with TID: {TID}, error: {ERROR}",
-                    "TID", tid, "ERROR", rc);
-                continue; // Continue to next terminus
-            }
+    co_return PLDM_SUCCESS;
+}
 
-            terminus->parseTerminusPDRs();
-        }
+exec::task<int> PlatformManager::initTerminus(pldm_tid_t tid)
+{
+    auto it = termini.find(tid);
+    if (it == termini.end() || !it->second || it->second->initialized)
+    {
+        co_return PLDM_SUCCESS;
+    }
+    /* Keep the terminus while it is initialized, even if it is removed */
+    auto terminus = it->second;
 
-        /**
-         * Need terminus name from PDRs before updating Inventory object with
-         * Fru data
-         */
-        if (fruData.size())
+    /* Get Fru */
+    uint16_t totalTableRecords = 0;
+    if (terminus->doesSupportCommand(PLDM_FRU,
+                                     PLDM_GET_FRU_RECORD_TABLE_METADATA))
+    {
+        auto rc = co_await getFRURecordTableMetadata(tid, &totalTableRecords);
+        if (rc)
         {
-            updateInventoryWithFru(tid, fruData.data(), fruData.size());
+            lg2::error(
+                "Failed to get FRU Metadata for terminus {TID}, error {ERROR}",
+                "TID", tid, "ERROR", rc);
         }
-
-        uint16_t terminusMaxBufferSize = terminus->maxBufferSize;
-        if (!terminus->doesSupportCommand(PLDM_PLATFORM,
-                                          PLDM_EVENT_MESSAGE_BUFFER_SIZE))
+        if (!totalTableRecords)
         {
-            terminusMaxBufferSize = PLDM_PLATFORM_DEFAULT_MESSAGE_BUFFER_SIZE;
+            lg2::info("Fru record table meta data has 0 records");
         }
-        else
+    }
+
+    std::vector<uint8_t> fruData{};
+    if ((totalTableRecords != 0) &&
+        terminus->doesSupportCommand(PLDM_FRU, PLDM_GET_FRU_RECORD_TABLE))
+    {
+        auto rc = co_await getFRURecordTables(tid, totalTableRecords, fruData);
+        if (rc)
         {
-            /* Get maxBufferSize use PLDM command eventMessageBufferSize */
-            auto rc = co_await eventMessageBufferSize(
-                tid, terminus->maxBufferSize, terminusMaxBufferSize);
-            if (rc != PLDM_SUCCESS)
-            {
-                lg2::error(
-                    "Failed to get message buffer size for terminus with TID: {TID}, error: {ERROR}",
-                    "TID", tid, "ERROR", rc);
-                terminusMaxBufferSize =
-                    PLDM_PLATFORM_DEFAULT_MESSAGE_BUFFER_SIZE;
-            }
+            lg2::error(
+                "Failed to get Fru Record table for terminus {TID}, error {ERROR}",
+                "TID", tid, "ERROR", rc);
         }
-        terminus->maxBufferSize =
-            std::min(terminus->maxBufferSize, terminusMaxBufferSize);
+    }
 
-        auto rc = co_await configEventReceiver(tid);
+    if (terminus->doesSupportCommand(PLDM_PLATFORM, PLDM_GET_PDR))
+    {
+        auto rc = co_await getPDRs(terminus, true);
         if (rc)
         {
             lg2::error(
-                "Failed to config event receiver for terminus with TID: {TID}, error: {ERROR}",
+                "Failed to fetch PDRs for terminus with TID: {TID}, error: {ERROR}",
                 "TID", tid, "ERROR", rc);
+            co_return rc;
         }
-        terminus->initialized = true;
 
-        const auto redfishResources = terminus->getRedfishResourcePdrsRaw();
+        terminus->completeTerminusPDRs();
+    }
 
-        if (!redfishResources.empty())
+    /**
+     * Need terminus name from PDRs before updating Inventory object with
+     * Fru data
+     */
+    if (fruData.size())
+    {
+        updateInventoryWithFru(tid, fruData.data(), fruData.size());
+    }
+
+    uint16_t terminusMaxBufferSize = terminus->maxBufferSize;
+    if (!terminus->doesSupportCommand(PLDM_PLATFORM,
+                                      PLDM_EVENT_MESSAGE_BUFFER_SIZE))
+    {
+        terminusMaxBufferSize = PLDM_PLATFORM_DEFAULT_MESSAGE_BUFFER_SIZE;
+    }
+    else
+    {
+        /* Get maxBufferSize use PLDM command eventMessageBufferSize */
+        auto rc = co_await eventMessageBufferSize(
+            tid, terminus->maxBufferSize, terminusMaxBufferSize);
+        if (rc != PLDM_SUCCESS)
         {
-            auto info = terminusManager.getMctpInfoForTid(tid);
-            if (info)
-            {
-                pldm::utils::emitRDEDeviceDetectedSignal(
-                    tid, info->first, info->second, redfishResources);
-            }
-            else
-            {
-                lg2::error(
-                    "Failed to find Mctp Info for terminus with TID: {TID}",
-                    "TID", tid);
-            }
+            lg2::error(
+                "Failed to get message buffer size for terminus with TID: {TID}, error: {ERROR}",
+                "TID", tid, "ERROR", rc);
+            terminusMaxBufferSize = PLDM_PLATFORM_DEFAULT_MESSAGE_BUFFER_SIZE;
         }
+    }
+    terminus->maxBufferSize =
+        std::min(terminus->maxBufferSize, terminusMaxBufferSize);
+
+    auto rc = co_await configEventReceiver(tid);
+    if (rc)
+    {
+        lg2::error(
+            "Failed to config event receiver for terminus with TID: {TID}, error: {ERROR}",
+            "TID", tid, "ERROR", rc);
+    }
+    terminus->initialized = true;
+
+    const auto redfishResources = terminus->getRedfishResourcePdrsRaw();
 
-        if (manager)
+    if (!redfishResources.empty())
+    {
+        auto info = terminusManager.getMctpInfoForTid(tid);
+        if (info)
         {
-            manager->startSensorPolling(tid);
+            pldm::utils::emitRDEDeviceDetectedSignal(
+                tid, info->first, info->second, redfishResources);
         }
         else
         {
-            lg2::error(
-                "Cannot start sensor polling for TID: {TID} because the manager is not initialized.",
-                "TID", tid);
+            lg2::error("Failed to find Mctp Info for terminus with TID: {TID}",
+                       "TID", tid);
         }
     }
 
+    if (manager)
+    {
+        manager->startSensorPolling(tid);
+    }
+    else
+    {
+        lg2::error(
+            "Cannot start sensor polling for TID: {TID} because the manager is not initialized.",
+            "TID", tid);
+    }
+
     co_return PLDM_SUCCESS;
 }
 
@@ -241,7 +261,8 @@ exec::task<int> PlatformManager::configEventReceiver(pldm_tid_t tid)
     co_return PLDM_SUCCESS;
 }
 
-exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
+exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus,
+                                         bool parse)
 {
     pldm_tid_t tid = terminus->getTid();
 
@@ -251,12 +272,14 @@ exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
     uint32_t recordCount = std::numeric_limits<uint32_t>::max();
     uint32_t repositorySize = 0;
     uint32_t largestRecordSize = std::numeric_limits<uint32_t>::max();
+    PdrRepositorySignature signature{};
+    std::optional<UUID> uuid;
     if (terminus->doesSupportCommand(PLDM_PLATFORM,
                                      PLDM_GET_PDR_REPOSITORY_INFO))
     {
-        auto rc =
-            co_await getPDRRepositoryInfo(tid, repositoryState, recordCount,
-                                          repositorySize, largestRecordSize);
+        auto rc = co_await getPDRRepositoryInfo(
+            tid, repositoryState, recordCount, repositorySize,
+            largestRecordSize, signature.updateTime, signature.oemUpdateTime);
         if (rc)
         {
             lg2::error(
@@ -265,6 +288,14 @@ exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
         }
         else
         {
+            signature.recordCount = recordCount;
+            signature.repositorySize = repositorySize;
+            signature.largestRecordSize = largestRecordSize;
+            auto mctpInfo = terminusManager.toMctpInfo(tid);
+            if (mctpInfo && signature.isValid())
+            {
+                uuid = std::get<1>(mctpInfo.value());
+            }
             recordCount =
                 std::min(recordCount + 1, std::numeric_limits<uint32_t>::max());
             largestRecordSize = std::min(largestRecordSize + 1,
@@ -277,79 +308,260 @@ exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
         co_return PLDM_ERROR_NOT_READY;
     }
 
+    if (parse)
+    {
+        terminus->resetTerminusPDRs();
+    }
+    else
+    {
+        terminus->pdrs.clear();
+    }
+    /* The PDRs are stored in one buffer, sized once when the repository size
+     * is known */
+    if (repositorySize)
+    {
+        terminus->pdrs.reserve(signature.recordCount, repositorySize);
+    }
+
+    /* Each PDR is parsed and its sensor created as soon as it is stored, the
+     * sensors are polled while the next PDRs are fetched */
+    bool pollingStarted = false;
+    auto addPDR = [&](std::span<const uint8_t> pdr) {
+        if (!parse)
+        {
+            terminus->pdrs.emplace_back(pdr);
+            return;
+        }
+        terminus->addTerminusPDR(pdr);
+        if (manager && !pollingStarted && !terminus->numericSensors.empty())
+        {
+            manager->startSensorPolling(tid);
+            pollingStarted = true;
+        }
+    };
+
+    /* The repository did not change since it was cached */
+    if (uuid)
+    {
+        auto pdrs = pdrCache.load(*uuid, signature);
+        if (pdrs)
+        {
+            lg2::info("Loaded {COUNT} cached PDRs of terminus {TID}", "COUNT",
+                      pdrs->size(), "TID", tid);
+            if (!parse)
+            {
+                terminus->pdrs = std::move(*pdrs);
+                co_return PLDM_SUCCESS;
+            }
+            for (auto pdr : *pdrs)
+            {
+                addPDR(pdr);
+            }
+            co_return PLDM_SUCCESS;
+        }
+    }
+
     uint32_t recordHndl = 0;
     uint32_t nextRecordHndl = 0;
+    uint32_t receivedRecordCount = 0;
+    std::vector<uint8_t> pdr;
+
+    do
+    {
+        auto rc = co_await getPDRRecord(tid, recordHndl, largestRecordSize,
+                                        pdr, nextRecordHndl);
+        if (rc)
+        {
+            /* Stop polling the sensors before they are removed, which also
+             * drops their pending signals */
+            if (pollingStarted)
+            {
+                manager->stopSensorPolling(tid);
+            }
+            if (parse)
+            {
+                terminus->resetTerminusPDRs();
+            }
+            terminus->pdrs.clear();
+            co_return rc;
+        }
+
+        if (!pdr.empty())
+        {
+            addPDR(pdr);
+            recordHndl = nextRecordHndl;
+        }
+        receivedRecordCount++;
+    } while (nextRecordHndl != 0 && receivedRecordCount < recordCount);
+
+    if (uuid)
+    {
+        pdrCache.store(*uuid, signature, terminus->pdrs);
+    }
+
+    co_return PLDM_SUCCESS;
+}
+
+exec::task<int> PlatformManager::getPDRRecord(
+    pldm_tid_t tid, uint32_t recordHndl, uint32_t largestRecordSize,
+    std::vector<uint8_t>& pdr, uint32_t& nextRecordHndl)
+{
     uint32_t nextDataTransferHndl = 0;
     uint8_t transferFlag = 0;
     uint16_t responseCnt = 0;
     constexpr uint16_t recvBufSize = PLDM_PLATFORM_GETPDR_MAX_RECORD_BYTES;
-    std::vector<uint8_t> recvBuf(recvBufSize);
     uint8_t transferCrc = 0;
 
-    terminus->pdrs.clear();
-    uint32_t receivedRecordCount = 0;
+    /* The parts are received in place at the end of the PDR, which keeps
+     * its capacity from the previous PDR */
+    pdr.resize(recvBufSize);
+    auto rc = co_await getPDR(tid, recordHndl, 0, PLDM_GET_FIRSTPART,
+                              recvBufSize, 0, nextRecordHndl,
+                              nextDataTransferHndl, transferFlag, responseCnt,
+                              pdr, transferCrc);
+    if (rc)
+    {
+        lg2::error(
+            "Failed to get PDRs for terminus {TID}, error: {RC}, first part of record handle {RECORD}",
+            "TID", tid, "RC", rc, "RECORD", recordHndl);
+        pdr.clear();
+        co_return rc;
+    }
 
-    do
+    if (transferFlag == PLDM_PLATFORM_TRANSFER_START_AND_END)
     {
-        auto rc =
-            co_await getPDR(tid, recordHndl, 0, PLDM_GET_FIRSTPART, recvBufSize,
-                            0, nextRecordHndl, nextDataTransferHndl,
-                            transferFlag, responseCnt, recvBuf, transferCrc);
+        // single-part
+        pdr.resize(responseCnt);
+        co_return PLDM_SUCCESS;
+    }
 
+    // multipart transfer
+    auto pdrHdr = new (pdr.data()) pldm_pdr_hdr;
+    uint16_t recordChgNum = le16toh(pdrHdr->record_change_num);
+    pdr.resize(responseCnt);
+    do
+    {
+        auto receivedRecordSize = pdr.size();
+        pdr.resize(receivedRecordSize + recvBufSize);
+        rc = co_await getPDR(
+            tid, recordHndl, nextDataTransferHndl, PLDM_GET_NEXTPART,
+            recvBufSize, recordChgNum, nextRecordHndl, nextDataTransferHndl,
+            transferFlag, responseCnt,
+            std::span(pdr).subspan(receivedRecordSize), transferCrc);
         if (rc)
         {
             lg2::error(
-                "Failed to get PDRs for terminus {TID}, error: {RC}, first part of record handle {RECORD}",
+                "Failed to get PDRs for terminus {TID}, error: {RC}, get middle part of record handle {RECORD}",
                 "TID", tid, "RC", rc, "RECORD", recordHndl);
-            terminus->pdrs.clear();
+            pdr.clear();
             co_return rc;
         }
+        pdr.resize(receivedRecordSize + responseCnt);
 
-        if (transferFlag == PLDM_PLATFORM_TRANSFER_START_AND_END)
+        if (transferFlag == PLDM_PLATFORM_TRANSFER_END)
         {
-            // single-part
-            terminus->pdrs.emplace_back(std::vector<uint8_t>(
-                recvBuf.begin(), recvBuf.begin() + responseCnt));
-            recordHndl = nextRecordHndl;
+            co_return PLDM_SUCCESS;
         }
-        else
-        {
-            // multipart transfer
-            uint32_t receivedRecordSize = responseCnt;
-            auto pdrHdr = new (recvBuf.data()) pldm_pdr_hdr;
-            uint16_t recordChgNum = le16toh(pdrHdr->record_change_num);
-            std::vector<uint8_t> receivedPdr(recvBuf.begin(),
-                                             recvBuf.begin() + responseCnt);
-            do
-            {
-                rc = co_await getPDR(
-                    tid, recordHndl, nextDataTransferHndl, PLDM_GET_NEXTPART,
-                    recvBufSize, recordChgNum, nextRecordHndl,
-                    nextDataTransferHndl, transferFlag, responseCnt, recvBuf,
-                    transferCrc);
-                if (rc)
-                {
-                    lg2::error(
-                        "Failed to get PDRs for terminus {TID}, error: {RC}, get middle part of record handle {RECORD}",
-                        "TID", tid, "RC", rc, "RECORD", recordHndl);
-                    terminus->pdrs.clear();
-                    co_return rc;
-                }
+    } while (nextDataTransferHndl != 0 && pdr.size() < largestRecordSize);
+
+    /* The transfer did not end */
+    pdr.clear();
+    co_return PLDM_SUCCESS;
+}
+
+exec::task<int> PlatformManager::updatePDRs(pldm_tid_t tid)
+{
+    auto it = termini.find(tid);
+    if (it == termini.end() || !it->second)
+    {
+        co_return PLDM_ERROR;
+    }
+    /* Keep the terminus while its PDRs are fetched, even if it is removed */
+    auto terminus = it->second;
+
+    auto changes = std::exchange(terminus->pdrChanges, PdrChanges{});
+    if (changes.empty() ||
+        !terminus->doesSupportCommand(PLDM_PLATFORM, PLDM_GET_PDR))
+    {
+        co_return PLDM_SUCCESS;
+    }
 
-                receivedPdr.insert(receivedPdr.end(), recvBuf.begin(),
-                                   recvBuf.begin() + responseCnt);
-                receivedRecordSize += responseCnt;
+    std::vector<std::vector<uint8_t>> changedPdrs;
+    if (changes.refreshAll)
+    {
+        /* Fetch the whole repository, then apply only the PDRs which
+         * differ from the current ones */
+        auto currentPdrs = std::move(terminus->pdrs);
+        terminus->pdrs.clear();
+        auto rc = co_await getPDRs(terminus, false);
+        auto newPdrs = std::exchange(terminus->pdrs, std::move(currentPdrs));
+        if (rc)
+        {
+            lg2::error(
+                "Failed to refresh PDRs for terminus with TID: {TID}, error: {ERROR}",
+                "TID", tid, "ERROR", rc);
+            /* Apply the changes again at the next update */
+            terminus->pdrChanges.mergeOlder(changes);
+            co_return rc;
+        }
 
-                if (transferFlag == PLDM_PLATFORM_TRANSFER_END)
+        /* The current PDRs not found in the repository are deleted */
+        std::map<uint32_t, std::span<const uint8_t>> deletedPdrs;
+        for (auto pdr : terminus->pdrs)
+        {
+            if (pdr.size() >= sizeof(pldm_pdr_hdr))
+            {
+                auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
+                deletedPdrs.emplace(le32toh(pdrHdr->record_handle), pdr);
+            }
+        }
+        for (auto pdr : newPdrs)
+        {
+            if (pdr.size() < sizeof(pldm_pdr_hdr))
+            {
+                continue;
+            }
+            auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
+            auto current = deletedPdrs.find(le32toh(pdrHdr->record_handle));
+            if (current != deletedPdrs.end())
+            {
+                auto unchanged = std::ranges::equal(current->second, pdr);
+                deletedPdrs.erase(current);
+                if (unchanged)
                 {
-                    terminus->pdrs.emplace_back(std::move(receivedPdr));
-                    recordHndl = nextRecordHndl;
+                    continue;
                 }
-            } while (nextDataTransferHndl != 0 &&
-                     receivedRecordSize < largestRecordSize);
+            }
+            changedPdrs.emplace_back(pdr.begin(), pdr.end());
         }
-        receivedRecordCount++;
-    } while (nextRecordHndl != 0 && receivedRecordCount < recordCount);
+        for (const auto& [handle, pdr] : deletedPdrs)
+        {
+            changes.deletedHandles.insert(handle);
+        }
+    }
+    else
+    {
+        for (auto handle : changes.changedHandles)
+        {
+            std::vector<uint8_t> pdr;
+            uint32_t nextRecordHndl = 0;
+            auto rc = co_await getPDRRecord(
+                tid, handle, std::numeric_limits<uint32_t>::max(), pdr,
+                nextRecordHndl);
+            if (rc)
+            {
+                terminus->pdrChanges.mergeOlder(changes);
+                co_return rc;
+            }
+            if (!pdr.empty())
+            {
+                changedPdrs.emplace_back(std::move(pdr));
+            }
+        }
+    }
+
+    terminus->updateTerminusPDRs(changes.deletedHandles,
+                                 std::move(changedPdrs));
 
     co_return PLDM_SUCCESS;
 }
@@ -360,7 +572,7 @@ exec::task<int> PlatformManager::getPDR(
     const uint16_t requestCnt, const uint16_t recordChgNum,
     uint32_t& nextRecordHndl, uint32_t& nextDataTransferHndl,
     uint8_t& transferFlag, uint16_t& responseCnt,
-    std::vector<uint8_t>& recordData, uint8_t& transferCrc)
+    std::span<uint8_t> recordData, uint8_t& transferCrc)
 {
     Request request(sizeof(pldm_msg_hdr) + PLDM_GET_PDR_REQ_BYTES);
     auto requestMsg = new (request.data()) pldm_msg;
@@ -412,7 +624,9 @@ exec::task<int> PlatformManager::getPDR(
 
 exec::task<int> PlatformManager::getPDRRepositoryInfo(
     const pldm_tid_t tid, uint8_t& repositoryState, uint32_t& recordCount,
-    uint32_t& repositorySize, uint32_t& largestRecordSize)
+    uint32_t& repositorySize, uint32_t& largestRecordSize,
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE>& updateTime,
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE>& oemUpdateTime)
 {
     Request request(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
     auto requestMsg = new (request.data()) pldm_msg;
@@ -439,8 +653,6 @@ exec::task<int> PlatformManager::getPDRRepositoryInfo(
     }
 
     uint8_t completionCode = 0;
-    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime = {};
-    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> oemUpdateTime = {};
     uint8_t dataTransferHandleTimeout = 0;
 
     rc = decode_get_pdr_repository_info_resp(
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "pdr_cache.hpp"
 #include "terminus.hpp"
 #include "terminus_manager.hpp"
 
@@ -7,6 +8,8 @@
 #include <libpldm/platform.h>
 #include <libpldm/pldm.h>
 
+#include <array>
+#include <span>
 #include <vector>
 
 namespace pldm
@@ -36,6 +39,9 @@ class PlatformManager
     {}
 
     /** @brief Initialize terminus which supports PLDM Type 2
+     *
+     *  The termini not initialized yet are initialized concurrently, up to
+     *  TERMINUS_INIT_MAX_CONCURRENCY at a time.
      *
      *  @return coroutine return_value - PLDM completion code
      */
@@ -48,13 +54,52 @@ class PlatformManager
      */
     exec::task<int> configEventReceiver(pldm_tid_t tid);
 
+    /** @brief Apply the PDR repository changes signaled by a terminus
+     *
+     *  Only the added and modified PDRs are fetched, and only the sensors
+     *  of the changed PDRs are created again. A repository refresh fetches
+     *  all the PDRs but still only applies the PDRs which differ.
+     *
+     *  @param[in] tid - Destination TID
+     *  @return coroutine return_value - PLDM completion code
+     */
+    exec::task<int> updatePDRs(pldm_tid_t tid);
+
   private:
+    /** @brief Initialize one terminus: fetch its FRU table and PDRs, create
+     *         its sensors, configure its events and start polling it
+     *
+     *  @param[in] tid - Destination TID
+     *  @return coroutine return_value - PLDM completion code
+     */
+    exec::task<int> initTerminus(pldm_tid_t tid);
+
     /** @brief Fetch all PDRs from terminus.
      *
      *  @param[in] terminus - The terminus object to store fetched PDRs
+     *  @param[in] parse - parse each PDR and create its sensor as soon as it
+     *                     is received and poll the sensors while the next
+     *                     PDRs are fetched, else only store the PDRs. The
+     *                     polling is stopped and the sensors are removed if
+     *                     fetching a PDR fails.
+     *  @return coroutine return_value - PLDM completion code
+     */
+    exec::task<int> getPDRs(std::shared_ptr<Terminus> terminus,
+                            bool parse = false);
+
+    /** @brief Fetch one PDR from terminus, in one or more parts
+     *
+     *  @param[in] tid - Destination TID
+     *  @param[in] recordHndl - Record handle
+     *  @param[in] largestRecordSize - Largest record size of the repository
+     *  @param[out] pdr - The PDR, empty if the transfer did not end
+     *  @param[out] nextRecordHndl - Next record handle
      *  @return coroutine return_value - PLDM completion code
      */
-    exec::task<int> getPDRs(std::shared_ptr<Terminus> terminus);
+    exec::task<int> getPDRRecord(pldm_tid_t tid, uint32_t recordHndl,
+                                 uint32_t largestRecordSize,
+                                 std::vector<uint8_t>& pdr,
+                                 uint32_t& nextRecordHndl);
 
     /** @brief Fetch PDR from terminus
      *
@@ -78,7 +123,7 @@ class PlatformManager
         const uint16_t requestCnt, const uint16_t recordChgNum,
         uint32_t& nextRecordHndl, uint32_t& nextDataTransferHndl,
         uint8_t& transferFlag, uint16_t& responseCnt,
-        std::vector<uint8_t>& recordData, uint8_t& transferCrc);
+        std::span<uint8_t> recordData, uint8_t& transferCrc);
 
     /** @brief get PDR repository information.
      *
@@ -87,12 +132,16 @@ class PlatformManager
      *  @param[out] recordCount - number of records
      *  @param[out] repositorySize - repository size
      *  @param[out] largestRecordSize - largest record size
+     *  @param[out] updateTime - time of the last repository update
+     *  @param[out] oemUpdateTime - time of the last OEM repository update
      * *
      *  @return coroutine return_value - PLDM completion code
      */
     exec::task<int> getPDRRepositoryInfo(
         const pldm_tid_t tid, uint8_t& repositoryState, uint32_t& recordCount,
-        uint32_t& repositorySize, uint32_t& largestRecordSize);
+        uint32_t& repositorySize, uint32_t& largestRecordSize,
+        std::array<uint8_t, PLDM_TIMESTAMP104_SIZE>& updateTime,
+        std::array<uint8_t, PLDM_TIMESTAMP104_SIZE>& oemUpdateTime);
 
     /** @brief Send setEventReceiver command to destination EID.
      *
@@ -193,6 +242,9 @@ class PlatformManager
      *        and other platform-level PLDM operations.
      */
     Manager* manager;
+
+    /** @brief PDRs of the termini kept across restarts */
+    PdrCache pdrCache;
 };
 } // namespace platform_mc
 } // namespace pldm
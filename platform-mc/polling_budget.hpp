@@ -0,0 +1,364 @@
+#pragma once
+
+#include "common/types.hpp"
+
+#include <libpldm/base.h>
+
+#include <sdbusplus/async.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <map>
+#include <optional>
+#include <utility>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/**
+ * @brief PollingBudget
+ *
+ * Bounds the number of sensor readings in flight over all the MCTP networks
+ * and for each terminus. A terminus waiting for a slot is queued on the MCTP
+ * network of its endpoint, and the networks are served round robin so that
+ * a busy network does not starve the others.
+ */
+class PollingBudget
+{
+  public:
+    /** @class Waiter
+     *
+     *  A terminus waiting for a slot
+     */
+    class Waiter
+    {
+      public:
+        Waiter() = delete;
+        Waiter(const Waiter&) = delete;
+        Waiter& operator=(const Waiter&) = delete;
+        virtual ~Waiter() = default;
+
+        explicit Waiter(pldm_tid_t tid) : tid(tid) {}
+
+        /** @brief Called when the slot is acquired */
+        virtual void grant() = 0;
+
+        pldm_tid_t tid; //!< terminus waiting for the slot
+    };
+
+    PollingBudget() = delete;
+    PollingBudget(const PollingBudget&) = delete;
+    PollingBudget& operator=(const PollingBudget&) = delete;
+
+    /** @brief Constructor
+     *
+     *  @param[in] maxInFlight - readings in flight over all the termini
+     *  @param[in] maxTerminusInFlight - readings in flight for one terminus
+     */
+    explicit PollingBudget(size_t maxInFlight, size_t maxTerminusInFlight) :
+        maxInFlight(std::max<size_t>(maxInFlight, 1)),
+        maxTerminusInFlight(std::max<size_t>(maxTerminusInFlight, 1))
+    {}
+
+    /** @brief Acquire a slot, or wait for one
+     *
+     *  @param[in] waiter - the terminus waiting for the slot
+     *  @param[in] networkId - MCTP network of the terminus endpoint
+     *
+     *  @return true if the slot is acquired, false if the waiter is queued
+     *          and granted the slot later
+     */
+    bool acquire(Waiter& waiter, NetworkId networkId)
+    {
+        if (hasSlot(waiter.tid))
+        {
+            take(waiter.tid);
+            return true;
+        }
+        waiters[networkId].push_back(&waiter);
+        return false;
+    }
+
+    /** @brief Stop waiting for a slot
+     *
+     *  @param[in] waiter - the queued terminus
+     */
+    void cancel(Waiter& waiter)
+    {
+        for (auto it = waiters.begin(); it != waiters.end(); ++it)
+        {
+            auto& queue = it->second;
+            auto queued = std::ranges::find(queue, &waiter);
+            if (queued != queue.end())
+            {
+                queue.erase(queued);
+                if (queue.empty())
+                {
+                    waiters.erase(it);
+                }
+                return;
+            }
+        }
+    }
+
+    /** @brief Release a slot and grant it to a waiting terminus
+     *
+     *  @param[in] tid - terminus which acquired the slot
+     */
+    void release(pldm_tid_t tid)
+    {
+        if (inFlight)
+        {
+            inFlight--;
+        }
+        auto terminus = terminusInFlight.find(tid);
+        if (terminus != terminusInFlight.end() && !--terminus->second)
+        {
+            terminusInFlight.erase(terminus);
+        }
+
+        // The granted waiter may acquire or release slots again, so the
+        // queues are searched again after each grant
+        while (auto waiter = nextWaiter())
+        {
+            take((*waiter)->tid);
+            (*waiter)->grant();
+        }
+    }
+
+    /** @brief Get the number of readings in flight */
+    size_t getInFlight() const
+    {
+        return inFlight;
+    }
+
+    /** @brief Get the number of readings in flight for a terminus
+     *
+     *  @param[in] tid - the terminus
+     */
+    size_t getInFlight(pldm_tid_t tid) const
+    {
+        auto terminus = terminusInFlight.find(tid);
+        return terminus == terminusInFlight.end() ? 0 : terminus->second;
+    }
+
+  private:
+    /** @brief Check if a terminus can acquire a slot */
+    bool hasSlot(pldm_tid_t tid) const
+    {
+        return inFlight < maxInFlight && getInFlight(tid) < maxTerminusInFlight;
+    }
+
+    /** @brief Account for a slot acquired by a terminus */
+    void take(pldm_tid_t tid)
+    {
+        inFlight++;
+        terminusInFlight[tid]++;
+    }
+
+    /** @brief Dequeue the next waiter which can acquire a slot, from the
+     *         network after the last one served
+     */
+    std::optional<Waiter*> nextWaiter()
+    {
+        if (inFlight >= maxInFlight || waiters.empty())
+        {
+            return std::nullopt;
+        }
+
+        auto start = lastNetwork ? waiters.upper_bound(*lastNetwork)
+                                 : waiters.begin();
+        for (size_t i = 0; i < waiters.size(); i++, start++)
+        {
+            if (start == waiters.end())
+            {
+                start = waiters.begin();
+            }
+
+            auto& queue = start->second;
+            auto waiter = std::ranges::find_if(
+                queue, [this](Waiter* w) { return hasSlot(w->tid); });
+            if (waiter != queue.end())
+            {
+                auto granted = *waiter;
+                lastNetwork = start->first;
+                queue.erase(waiter);
+                if (queue.empty())
+                {
+                    waiters.erase(start);
+                }
+                return granted;
+            }
+        }
+        return std::nullopt;
+    }
+
+    size_t maxInFlight;         //!< readings in flight over all the termini
+    size_t maxTerminusInFlight; //!< readings in flight for one terminus
+    size_t inFlight = 0;        //!< readings in flight
+    std::map<pldm_tid_t, size_t> terminusInFlight; //!< in flight per terminus
+
+    /** @brief Termini waiting for a slot, per MCTP network */
+    std::map<NetworkId, std::deque<Waiter*>> waiters;
+
+    /** @brief MCTP network of the last waiter granted a slot */
+    std::optional<NetworkId> lastNetwork;
+};
+
+/** @class PollingSlot
+ *
+ *  A slot acquired from the polling budget, released when destroyed
+ */
+class PollingSlot
+{
+  public:
+    PollingSlot() = delete;
+    PollingSlot(const PollingSlot&) = delete;
+    PollingSlot& operator=(const PollingSlot&) = delete;
+    PollingSlot& operator=(PollingSlot&&) = delete;
+
+    explicit PollingSlot(PollingBudget& budget, pldm_tid_t tid) :
+        budget(&budget), tid(tid)
+    {}
+
+    PollingSlot(PollingSlot&& other) noexcept :
+        budget(std::exchange(other.budget, nullptr)), tid(other.tid)
+    {}
+
+    ~PollingSlot()
+    {
+        if (budget)
+        {
+            budget->release(tid);
+        }
+    }
+
+  private:
+    PollingBudget* budget; //!< budget the slot was acquired from
+    pldm_tid_t tid;        //!< terminus which acquired the slot
+};
+
+/** @class AcquireSlotOperation
+ *
+ *  Represents the state of a terminus waiting for a polling slot
+ *
+ * @tparam stdexec::receiver - Execute receiver
+ */
+template <stdexec::receiver R>
+struct AcquireSlotOperation : public PollingBudget::Waiter
+{
+    AcquireSlotOperation() = delete;
+
+    explicit AcquireSlotOperation(PollingBudget& budget, pldm_tid_t tid,
+                                  NetworkId networkId, R&& r) :
+        PollingBudget::Waiter(tid), budget(budget), networkId(networkId),
+        receiver(std::move(r))
+    {}
+
+    /** @brief Acquire the slot or queue the terminus, and set up a stop
+     *         callback while it waits.
+     *
+     *  @param[in] op - operation request
+     */
+    friend void tag_invoke(stdexec::start_t, AcquireSlotOperation& op) noexcept
+    {
+        auto stopToken = stdexec::get_stop_token(stdexec::get_env(op.receiver));
+
+        // operation already cancelled
+        if (stopToken.stop_requested())
+        {
+            return stdexec::set_stopped(std::move(op.receiver));
+        }
+
+        if (op.budget.acquire(op, op.networkId))
+        {
+            return stdexec::set_value(std::move(op.receiver));
+        }
+
+        if (stopToken.stop_possible())
+        {
+            op.stopCallback.emplace(
+                std::move(stopToken),
+                std::bind(&AcquireSlotOperation::onStop, &op));
+        }
+    }
+
+    /** @brief Dequeue the terminus and set the state to stopped on the
+     *         receiver.
+     */
+    void onStop()
+    {
+        budget.cancel(*this);
+        return stdexec::set_stopped(std::move(receiver));
+    }
+
+    /** @brief Reset the stop callback and complete the operation */
+    void grant() override
+    {
+        stopCallback.reset();
+        return stdexec::set_value(std::move(receiver));
+    }
+
+  private:
+    /** @brief The budget the slot is acquired from */
+    PollingBudget& budget;
+
+    /** @brief MCTP network of the terminus endpoint */
+    NetworkId networkId;
+
+    /** @brief The receiver to be notified when the slot is acquired */
+    R receiver;
+
+    /** @brief An optional callback that handles stopping the operation if
+     *         requested.
+     */
+    std::optional<typename stdexec::stop_token_of_t<
+        stdexec::env_of_t<R>>::template callback_type<std::function<void()>>>
+        stopCallback = std::nullopt;
+};
+
+/** @class AcquireSlotSender
+ *
+ *  Completes when the terminus acquired a polling slot, which it releases
+ *  with PollingBudget::release once the reading completed.
+ */
+struct AcquireSlotSender
+{
+    using is_sender = void;
+
+    AcquireSlotSender() = delete;
+
+    explicit AcquireSlotSender(PollingBudget& budget, pldm_tid_t tid,
+                               NetworkId networkId) :
+        budget(budget), tid(tid), networkId(networkId)
+    {}
+
+    friend auto tag_invoke(stdexec::get_completion_signatures_t,
+                           const AcquireSlotSender&, auto)
+        -> stdexec::completion_signatures<stdexec::set_value_t(),
+                                          stdexec::set_stopped_t()>;
+
+    /** @brief Execute acquiring the slot */
+    template <stdexec::receiver R>
+    friend auto tag_invoke(stdexec::connect_t, AcquireSlotSender&& self, R r)
+    {
+        return AcquireSlotOperation<R>(self.budget, self.tid, self.networkId,
+                                       std::move(r));
+    }
+
+  private:
+    /** @brief The budget the slot is acquired from */
+    PollingBudget& budget;
+
+    /** @brief Terminus acquiring the slot */
+    pldm_tid_t tid;
+
+    /** @brief MCTP network of the terminus endpoint */
+    NetworkId networkId;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @brief Widths in seconds of the windows the sensor history aggregates the
+ *         readings over
+ */
+constexpr std::array<uint32_t, 3> sensorHistoryWindows = {1, 60, 600};
+
+/** @brief Number of sensor history windows */
+constexpr size_t numSensorHistoryWindows = sensorHistoryWindows.size();
+
+/**
+ * @brief SensorHistory
+ *
+ * The recent readings of the numeric sensors of a terminus, indexed like
+ * Terminus::numericSensors. For each sensor and each window width of
+ * sensorHistoryWindows, a ring of fixed length keeps the minimum, maximum and
+ * average of the readings of the last windows. The rings of all the sensors
+ * are allocated in one array when the sensors are added, so recording a
+ * reading does not allocate.
+ */
+class SensorHistory
+{
+  public:
+    /** @struct Bucket
+     *
+     *  Aggregate of the readings of a sensor over one window
+     */
+    struct Bucket
+    {
+        uint32_t period = 0; //!< CLOCK_MONOTONIC seconds / window width
+        uint32_t count = 0;  //!< number of readings, 0 if the bucket is unused
+        float min = 0;       //!< smallest reading
+        float max = 0;       //!< largest reading
+        double sum = 0;      //!< sum of the readings
+    };
+
+    /** @brief Constructor
+     *
+     *  @param[in] length - number of windows kept per sensor and window
+     *                      width, 0 disables the history
+     */
+    explicit SensorHistory(size_t length = SENSOR_HISTORY_LENGTH) :
+        length(length)
+    {}
+
+    /** @brief Add a sensor
+     *
+     *  @return index of the sensor
+     */
+    size_t add()
+    {
+        buckets.resize(buckets.size() + numSensorHistoryWindows * length);
+        heads.resize(heads.size() + numSensorHistoryWindows, 0);
+        return size() - 1;
+    }
+
+    /** @brief Get the number of sensors */
+    size_t size() const
+    {
+        return heads.size() / numSensorHistoryWindows;
+    }
+
+    /** @brief Remove a sensor, the next sensors move down one index
+     *
+     *  @param[in] index - index of the sensor
+     */
+    void remove(size_t index)
+    {
+        if (index >= size())
+        {
+            return;
+        }
+        auto ring = index * numSensorHistoryWindows;
+        auto first = buckets.begin() + ring * length;
+        buckets.erase(first, first + numSensorHistoryWindows * length);
+        auto head = heads.begin() + ring;
+        heads.erase(head, head + numSensorHistoryWindows);
+    }
+
+    /** @brief Get the number of windows kept per sensor and window width */
+    size_t getLength() const
+    {
+        return length;
+    }
+
+    /** @brief Find a window width
+     *
+     *  @param[in] seconds - the window width in seconds
+     *
+     *  @return index of the window width in sensorHistoryWindows,
+     *          std::nullopt if not aggregated
+     */
+    static std::optional<size_t> findWindow(uint32_t seconds)
+    {
+        auto it = std::ranges::find(sensorHistoryWindows, seconds);
+        if (it == sensorHistoryWindows.end())
+        {
+            return std::nullopt;
+        }
+        return it - sensorHistoryWindows.begin();
+    }
+
+    /** @brief Add a reading to the windows of a sensor
+     *
+     *  @param[in] index - index of the sensor
+     *  @param[in] value - reading in the sensor units, not a number is
+     *                     ignored
+     *  @param[in] now - CLOCK_MONOTONIC microseconds
+     */
+    void record(size_t index, double value, uint64_t now)
+    {
+        if (!length || index >= size() || !std::isfinite(value))
+        {
+            return;
+        }
+
+        auto seconds = now / 1000000;
+        for (size_t window = 0; window < numSensorHistoryWindows; window++)
+        {
+            auto period =
+                static_cast<uint32_t>(seconds / sensorHistoryWindows[window]);
+            auto ring = index * numSensorHistoryWindows + window;
+            auto& head = heads[ring];
+            auto bucket = &buckets[ring * length + head];
+            if (bucket->count && bucket->period != period)
+            {
+                head = (head == length - 1) ? 0 : head + 1;
+                bucket = &buckets[ring * length + head];
+                bucket->count = 0;
+            }
+
+            auto reading = static_cast<float>(value);
+            if (!bucket->count)
+            {
+                *bucket = Bucket{period, 0, reading, reading, 0};
+            }
+            bucket->count++;
+            bucket->min = std::min(bucket->min, reading);
+            bucket->max = std::max(bucket->max, reading);
+            bucket->sum += value;
+        }
+    }
+
+    /** @brief Get the windows of a sensor holding readings
+     *
+     *  @param[in] index - index of the sensor
+     *  @param[in] window - index of the window width in sensorHistoryWindows
+     *
+     *  @return the buckets from the oldest to the newest
+     */
+    std::vector<Bucket> getBuckets(size_t index, size_t window) const
+    {
+        std::vector<Bucket> result;
+        if (!length || index >= size() || window >= numSensorHistoryWindows)
+        {
+            return result;
+        }
+
+        auto ring = index * numSensorHistoryWindows + window;
+        auto first = buckets.begin() + ring * length;
+        auto head = heads[ring];
+        result.reserve(length);
+        for (size_t i = 1; i <= length; i++)
+        {
+            const auto& bucket = first[(head + i) % length];
+            if (bucket.count)
+            {
+                result.emplace_back(bucket);
+            }
+        }
+        return result;
+    }
+
+  private:
+    /** @brief Number of windows kept per sensor and window width */
+    size_t length;
+
+    /** @brief The rings, numSensorHistoryWindows of length buckets per
+     *         sensor
+     */
+    std::vector<Bucket> buckets;
+
+    /** @brief Bucket of the newest window of each ring */
+    std::vector<size_t> heads;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -16,7 +16,10 @@ SensorManager::SensorManager(sdeventplus::Event& event,
                              TerminusManager& terminusManager,
                              TerminiMapper& termini, Manager* manager) :
     event(event), terminusManager(terminusManager), termini(termini),
-    pollingTime(SENSOR_POLLING_TIME), manager(manager)
+    pollingTime(SENSOR_POLLING_TIME),
+    pollingBudget(SENSOR_POLLING_MAX_IN_FLIGHT,
+                  SENSOR_POLLING_TERMINUS_MAX_IN_FLIGHT),
+    manager(manager)
 {}
 
 void SensorManager::startPolling(pldm_tid_t tid)
@@ -26,7 +29,7 @@ void SensorManager::startPolling(pldm_tid_t tid)
         return;
     }
 
-    /* tid already initializes roundRobinSensors list */
+    /* tid already initializes the sensor scheduler */
     if (sensorPollTimers.contains(tid))
     {
         lg2::info("Terminus ID {TID}: sensor poll timer already exists.", "TID",
@@ -34,7 +37,7 @@ void SensorManager::startPolling(pldm_tid_t tid)
         return;
     }
 
-    roundRobinSensorItMap[tid] = 0;
+    sensorSchedulers[tid] = SensorScheduler{};
 
     updateAvailableState(tid, true);
 
@@ -83,7 +86,9 @@ void SensorManager::disableTerminusSensors(pldm_tid_t tid)
     {
         sensor->updateReading(true, false,
                               std::numeric_limits<double>::quiet_NaN());
+        sensor->emitPropertiesChanged();
     }
+    pendingSignalSensors.erase(tid);
 }
 
 void SensorManager::stopPolling(pldm_tid_t tid)
@@ -95,7 +100,7 @@ void SensorManager::stopPolling(pldm_tid_t tid)
         sensorPollTimers.erase(tid);
     }
 
-    roundRobinSensorItMap.erase(tid);
+    sensorSchedulers.erase(tid);
 
     if (doSensorPollingTaskHandles.contains(tid))
     {
@@ -104,27 +109,46 @@ void SensorManager::stopPolling(pldm_tid_t tid)
         doSensorPollingTaskHandles.erase(tid);
     }
 
+    emitSensorSignals(tid);
+    pendingSignalSensors.erase(tid);
+
     availableState.erase(tid);
 }
 
+void SensorManager::emitSensorSignals(pldm_tid_t tid)
+{
+    auto it = pendingSignalSensors.find(tid);
+    if (it == pendingSignalSensors.end())
+    {
+        return;
+    }
+
+    for (auto& sensor : it->second)
+    {
+        sensor->emitPropertiesChanged();
+    }
+    it->second.clear();
+}
+
 void SensorManager::doSensorPolling(pldm_tid_t tid)
 {
     auto it = doSensorPollingTaskHandles.find(tid);
-    if (it != doSensorPollingTaskHandles.end())
+    if (it == doSensorPollingTaskHandles.end())
     {
-        auto& [scope, rcOpt] = it->second;
-        if (!rcOpt.has_value())
-        {
-            return;
-        }
-        doSensorPollingTaskHandles.erase(tid);
+        it = doSensorPollingTaskHandles
+                 .emplace(std::piecewise_construct, std::forward_as_tuple(tid),
+                          std::forward_as_tuple())
+                 .first;
+    }
+    else if (!it->second.second.has_value())
+    {
+        return;
     }
 
-    auto& [scope, rcOpt] =
-        doSensorPollingTaskHandles
-            .emplace(std::piecewise_construct, std::forward_as_tuple(tid),
-                     std::forward_as_tuple())
-            .first->second;
+    /* The scope is kept as the sensor readings of the previous polling task
+     * can still be in flight */
+    auto& [scope, rcOpt] = it->second;
+    rcOpt.reset();
     scope.spawn(
         stdexec::just() | stdexec::let_value([this, &rcOpt,
                                               tid] -> exec::task<void> {
@@ -162,9 +186,7 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
 {
     uint64_t t0 = 0;
     uint64_t t1 = 0;
-    uint64_t elapsed = 0;
     uint64_t pollingTimeInUsec = pollingTime * 1000;
-    uint8_t rc = PLDM_SUCCESS;
 
     do
     {
@@ -176,6 +198,9 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
 
         sd_event_now(event.get(), CLOCK_MONOTONIC, &t0);
 
+        /* The sensor updates of the last polling cycle are signaled together */
+        emitSensorSignals(tid);
+
         /**
          * Terminus is not available for PLDM request.
          * The terminus manager will trigger recovery process to recovery the
@@ -216,22 +241,88 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
             co_await manager->oemPollForPlatformEvent(tid);
         }
 
+        /* The PDR changes are applied while no sensor of the terminus is
+         * being read, the sensors are then scheduled again. The readings
+         * completed since the signals were emitted are signaled first, so
+         * the replaced sensors are released before their D-Bus paths are
+         * used again */
+        bool sensorsChanged = false;
+        if (manager && !terminus->pdrChanges.empty() &&
+            !pollingBudget.getInFlight(tid))
+        {
+            emitSensorSignals(tid);
+            co_await manager->updatePDRs(tid);
+            sensorsChanged = true;
+        }
+
         sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
 
         auto& numericSensors = terminus->numericSensors;
-        auto toBeUpdated = numericSensors.size();
 
-        if (!roundRobinSensorItMap.contains(tid))
+        if (!sensorSchedulers.contains(tid))
         {
             lg2::info(
-                "Terminus ID {TID} does not have a round robin sensor iteration {NOW}.",
+                "Terminus ID {TID} does not have a sensor scheduler {NOW}.",
                 "TID", tid, "NOW", pldm::utils::getCurrentSystemTime());
             co_return PLDM_ERROR;
         }
-        auto& sensorIt = roundRobinSensorItMap[tid];
+        auto& scheduler = sensorSchedulers[tid];
+
+        auto handle = doSensorPollingTaskHandles.find(tid);
+        if (handle == doSensorPollingTaskHandles.end())
+        {
+            co_return PLDM_ERROR;
+        }
+        auto& scope = handle->second.first;
+
+        /**
+         * The sensors are either scheduled or being read, schedule them again
+         * when the sensor list changed or a polling task was stopped while a
+         * sensor was being read.
+         */
+        auto numScheduled = scheduler.size() + pollingBudget.getInFlight(tid);
+        if (sensorsChanged || numScheduled != numericSensors.size())
+        {
+            const auto& table = terminus->numericSensorTable;
+            scheduler.reset(
+                std::min(numericSensors.size(), table.size()),
+                [&table](size_t index) { return table.getDueTime(index); });
+        }
 
-        while (((t1 - t0) < pollingTimeInUsec) && (toBeUpdated > 0))
+        NetworkId networkId = 0;
+        if (auto mctpInfo = terminusManager.toMctpInfo(tid))
         {
+            networkId = std::get<3>(*mctpInfo);
+        }
+
+        /**
+         * Only the sensors due at the start of the polling tick are read, a
+         * sensor scheduled again during the tick is read on a later tick.
+         * The readings run concurrently, up to the polling budget.
+         */
+        auto now = t1;
+        while ((t1 - t0) < pollingTimeInUsec)
+        {
+            auto index = scheduler.popDue(now);
+            if (!index)
+            {
+                break;
+            }
+
+            if (*index >= numericSensors.size())
+            {
+                continue;
+            }
+
+            /* A numeric sensor event since the sensor was scheduled can
+             * delay its reading to the heartbeat interval */
+            auto dueTime = terminus->numericSensorTable.getDueTime(*index);
+            if (dueTime > now)
+            {
+                scheduler.schedule(*index, dueTime);
+                continue;
+            }
+
             if (!getAvailableState(tid))
             {
                 lg2::info(
@@ -240,40 +331,25 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
                 co_await stdexec::just_stopped();
             }
 
-            if (sensorIt >= numericSensors.size())
-            {
-                sensorIt = 0;
-            }
-
-            auto sensor = numericSensors[sensorIt];
+            auto sensor = numericSensors[*index];
+            co_await AcquireSlotSender(pollingBudget, tid, networkId);
 
-            sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
-            elapsed = t1 - sensor->timeStamp;
-            if ((sensor->updateTime <= elapsed) || (!sensor->timeStamp))
+            if ((!sensorPollTimers.contains(tid)) ||
+                (sensorPollTimers[tid] && !sensorPollTimers[tid]->isRunning()))
             {
-                rc = co_await getSensorReading(sensor);
-
-                if ((!sensorPollTimers.contains(tid)) ||
-                    (sensorPollTimers[tid] &&
-                     !sensorPollTimers[tid]->isRunning()))
-                {
-                    co_return PLDM_ERROR;
-                }
-                sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
-                if (rc == PLDM_SUCCESS)
-                {
-                    sensor->timeStamp = t1;
-                }
-                else
-                {
-                    lg2::error(
-                        "Failed to get sensor value for terminus {TID}, error: {RC}",
-                        "TID", tid, "RC", rc);
-                }
+                pollingBudget.release(tid);
+                co_return PLDM_ERROR;
             }
 
-            toBeUpdated--;
-            sensorIt++;
+            scope.spawn(
+                stdexec::just() |
+                    stdexec::let_value(
+                        [this, tid, index = *index, sensor,
+                         slot = PollingSlot(pollingBudget, tid)]() mutable {
+                            return readSensor(tid, index, sensor,
+                                              std::move(slot));
+                        }),
+                exec::default_task_context<void>(exec::inline_scheduler{}));
 
             sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
         }
@@ -284,9 +360,68 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
     co_return PLDM_SUCCESS;
 }
 
+exec::task<void> SensorManager::readSensor(
+    pldm_tid_t tid, size_t index, std::shared_ptr<NumericSensor> sensor,
+    [[maybe_unused]] PollingSlot slot)
+{
+    auto wasPending = sensor->hasPendingSignals();
+    double rawValue = std::numeric_limits<double>::quiet_NaN();
+    auto rc = co_await getSensorReading(sensor, rawValue);
+
+    /* Polling stopped while reading, the sensor is not kept for the next
+     * polling cycle since it may be removed with its terminus */
+    if ((!sensorPollTimers.contains(tid)) ||
+        (sensorPollTimers[tid] && !sensorPollTimers[tid]->isRunning()))
+    {
+        sensor->emitPropertiesChanged();
+        co_return;
+    }
+
+    if (!wasPending && sensor->hasPendingSignals())
+    {
+        pendingSignalSensors[tid].emplace_back(sensor);
+    }
+
+    auto scheduler = sensorSchedulers.find(tid);
+    auto terminus = termini.find(tid);
+    if (scheduler == sensorSchedulers.end() || terminus == termini.end() ||
+        !terminus->second ||
+        index >= terminus->second->numericSensorTable.size())
+    {
+        co_return;
+    }
+    auto& table = terminus->second->numericSensorTable;
+
+    uint64_t t1 = 0;
+    sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
+    if (rc == PLDM_SUCCESS)
+    {
+        table.adaptPollInterval(
+            index,
+            sensor->isSteady(sensor->toUnits(table.steadyRawValues[index]),
+                             sensor->toUnits(rawValue)),
+            rawValue);
+        table.recordReading(index, rawValue, t1);
+        terminus->second->numericSensorHistory.record(
+            index, sensor->toUnits(rawValue), t1);
+        scheduler->second.schedule(index, table.getDueTime(index));
+    }
+    else
+    {
+        lg2::error("Failed to get sensor value for terminus {TID}, error: {RC}",
+                   "TID", tid, "RC", rc);
+        table.recordFailure(index);
+        table.adaptPollInterval(index, false,
+                                std::numeric_limits<double>::quiet_NaN());
+        /* retry on the next polling tick */
+        scheduler->second.schedule(index, t1 + 1);
+    }
+}
+
 exec::task<int> SensorManager::getSensorReading(
-    std::shared_ptr<NumericSensor> sensor)
+    std::shared_ptr<NumericSensor> sensor, double& rawValue)
 {
+    rawValue = std::numeric_limits<double>::quiet_NaN();
     if (!sensor)
     {
         lg2::error("Call `getSensorReading` with null `sensor` pointer.");
@@ -404,6 +539,7 @@ exec::task<int> SensorManager::getSensorReading(
             break;
     }
 
+    rawValue = value;
     sensor->updateReading(true, true, value);
     co_return completionCode;
 }
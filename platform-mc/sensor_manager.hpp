@@ -1,7 +1,9 @@
 #pragma once
 
 #include "common/types.hpp"
+#include "polling_budget.hpp"
 #include "requester/handler.hpp"
+#include "sensor_scheduler.hpp"
 #include "terminus.hpp"
 #include "terminus_manager.hpp"
 
@@ -78,6 +80,11 @@ class SensorManager
     };
 
   protected:
+    /** @brief Emit the D-Bus signals of the sensors of a terminus updated
+     *         since the last polling task
+     */
+    void emitSensorSignals(pldm_tid_t tid);
+
     /** @brief start a coroutine for polling all sensors.
      */
     virtual void doSensorPolling(pldm_tid_t tid);
@@ -92,9 +99,24 @@ class SensorManager
     /** @brief Sending getSensorReading command for the sensor
      *
      *  @param[in] sensor - the sensor to be updated
+     *  @param[out] rawValue - the raw reading, not a number if the sensor is
+     *                         not enabled
      *  @return coroutine return_value - PLDM completion code
      */
-    exec::task<int> getSensorReading(std::shared_ptr<NumericSensor> sensor);
+    exec::task<int> getSensorReading(std::shared_ptr<NumericSensor> sensor,
+                                     double& rawValue);
+
+    /** @brief Read a sensor and schedule its next reading
+     *
+     *  @param[in] tid - Destination TID
+     *  @param[in] index - index of the sensor in the terminus sensor list
+     *  @param[in] sensor - the sensor to be updated
+     *  @param[in] slot - polling slot, released when the reading completed
+     *                    or was stopped
+     */
+    exec::task<void> readSensor(pldm_tid_t tid, size_t index,
+                                std::shared_ptr<NumericSensor> sensor,
+                                PollingSlot slot);
 
     /** @brief Reference to to PLDM daemon's main event loop.
      */
@@ -119,8 +141,15 @@ class SensorManager
     /** @brief Available state for pldm request of terminus */
     std::map<pldm_tid_t, Availability> availableState;
 
-    /** @brief Round robin sensor iter of terminus */
-    std::map<pldm_tid_t, SensorID> roundRobinSensorItMap;
+    /** @brief Sensors of terminus ordered by the time they are next due */
+    std::map<pldm_tid_t, SensorScheduler> sensorSchedulers;
+
+    /** @brief Sensors of terminus with D-Bus signals to emit */
+    std::map<pldm_tid_t, std::vector<std::shared_ptr<NumericSensor>>>
+        pendingSignalSensors;
+
+    /** @brief Sensor readings in flight over all the termini */
+    PollingBudget pollingBudget;
 
     /** @brief pointer to Manager */
     Manager* manager;
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/**
+ * @brief SensorScheduler
+ *
+ * Min-heap of the sensors of a terminus keyed on the time each sensor is next
+ * due for polling, so a polling tick only touches the sensors that are due
+ * instead of scanning all of them. The sensors are identified by their index
+ * in the terminus sensor list and the times are CLOCK_MONOTONIC microseconds.
+ */
+class SensorScheduler
+{
+  public:
+    /** @brief Schedule all the sensors again
+     *
+     *  @param[in] numSensors - number of sensors of the terminus
+     *  @param[in] getDueTime - callable returning the due time of a sensor
+     *                          from its index
+     */
+    template <typename DueTimeFn>
+    void reset(size_t numSensors, DueTimeFn&& getDueTime)
+    {
+        heap.clear();
+        heap.reserve(numSensors);
+        for (size_t index = 0; index < numSensors; index++)
+        {
+            heap.emplace_back(getDueTime(index), index);
+        }
+        std::ranges::make_heap(heap, std::greater{});
+    }
+
+    /** @brief Schedule a sensor
+     *
+     *  @param[in] index - index of the sensor
+     *  @param[in] dueTime - time the sensor is next due
+     */
+    void schedule(size_t index, uint64_t dueTime)
+    {
+        heap.emplace_back(dueTime, index);
+        std::ranges::push_heap(heap, std::greater{});
+    }
+
+    /** @brief Remove the sensor due the earliest if it is due
+     *
+     *  @param[in] now - the current time
+     *
+     *  @return index of the sensor, std::nullopt if no sensor is due
+     */
+    std::optional<size_t> popDue(uint64_t now)
+    {
+        if (heap.empty() || heap.front().dueTime > now)
+        {
+            return std::nullopt;
+        }
+        std::ranges::pop_heap(heap, std::greater{});
+        auto index = heap.back().index;
+        heap.pop_back();
+        return index;
+    }
+
+    /** @brief Get the time the next sensor is due
+     *
+     *  @return the due time, std::nullopt if no sensor is scheduled
+     */
+    std::optional<uint64_t> nextDueTime() const
+    {
+        if (heap.empty())
+        {
+            return std::nullopt;
+        }
+        return heap.front().dueTime;
+    }
+
+    /** @brief Get the number of scheduled sensors */
+    size_t size() const
+    {
+        return heap.size();
+    }
+
+  private:
+    struct Entry
+    {
+        uint64_t dueTime; //!< time the sensor is next due
+        size_t index;     //!< index of the sensor
+
+        Entry(uint64_t dueTime, size_t index) : dueTime(dueTime), index(index)
+        {}
+
+        auto operator<=>(const Entry&) const = default;
+    };
+
+    /** @brief Min-heap of the scheduled sensors */
+    std::vector<Entry> heap;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "numeric_sensor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/**
+ * @brief SensorTable
+ *
+ * The state of the numeric sensors of a terminus which the sensor poller
+ * reads and writes on every reading, kept in contiguous arrays indexed like
+ * Terminus::numericSensors. The NumericSensor objects keep the D-Bus
+ * interfaces, the names and the PDRs which are only used when a reading is
+ * published.
+ *
+ * A sensor which reported a numeric sensor event is polled at the heartbeat
+ * interval instead of its update interval, until a poll finds no event for
+ * a heartbeat interval.
+ *
+ * With the adaptive polling, the polling interval of a sensor doubles after
+ * a number of steady readings in a row, up to the maximum interval, and goes
+ * back to the update interval on the first reading which is not steady. The
+ * readings are compared to the reading which started the steady run, so a
+ * slow drift ends the run once it exceeds the deadband.
+ */
+class SensorTable
+{
+  public:
+    /** @brief Status bits of a sensor */
+    enum Status : uint8_t
+    {
+        readingValid = 1 << 0, //!< the last raw value is a reading
+        readFailed = 1 << 1,   //!< the last reading failed
+    };
+
+    /** @brief Add a sensor
+     *
+     *  @param[in] sensorId - PDR sensor ID
+     *  @param[in] updateTime - update interval in microseconds
+     *  @param[in] conversion - conversion of the raw readings
+     *
+     *  @return index of the sensor
+     */
+    size_t add(uint16_t sensorId, uint64_t updateTime,
+               const SensorConversion& conversion)
+    {
+        sensorIds.emplace_back(sensorId);
+        updateTimes.emplace_back(updateTime);
+        pollIntervals.emplace_back(updateTime);
+        steadyCycles.emplace_back(0);
+        steadyRawValues.emplace_back(std::numeric_limits<double>::quiet_NaN());
+        timeStamps.emplace_back(0);
+        eventTimes.emplace_back(0);
+        rawValues.emplace_back(std::numeric_limits<double>::quiet_NaN());
+        scales.emplace_back(conversion.scale);
+        biases.emplace_back(conversion.bias);
+        statuses.emplace_back(0);
+        return sensorIds.size() - 1;
+    }
+
+    /** @brief Get the number of sensors */
+    size_t size() const
+    {
+        return sensorIds.size();
+    }
+
+    /** @brief Remove a sensor, the next sensors move down one index
+     *
+     *  @param[in] index - index of the sensor
+     */
+    void remove(size_t index)
+    {
+        auto erase = [index](auto& values) {
+            values.erase(values.begin() + index);
+        };
+        erase(sensorIds);
+        erase(updateTimes);
+        erase(pollIntervals);
+        erase(steadyCycles);
+        erase(steadyRawValues);
+        erase(timeStamps);
+        erase(eventTimes);
+        erase(rawValues);
+        erase(scales);
+        erase(biases);
+        erase(statuses);
+    }
+
+    /** @brief Find a sensor by its sensor ID
+     *
+     *  @param[in] sensorId - PDR sensor ID
+     *
+     *  @return index of the sensor, std::nullopt if not found
+     */
+    std::optional<size_t> find(uint16_t sensorId) const
+    {
+        auto it = std::ranges::find(sensorIds, sensorId);
+        if (it == sensorIds.end())
+        {
+            return std::nullopt;
+        }
+        return it - sensorIds.begin();
+    }
+
+    /** @brief Check if a sensor is polled at the heartbeat interval
+     *
+     *  @param[in] index - index of the sensor
+     *
+     *  @return true if the sensor reported an event less than a heartbeat
+     *          interval before its last reading, or after it
+     */
+    bool isEventDriven(size_t index) const
+    {
+        return heartbeatTime && eventTimes[index] &&
+               timeStamps[index] < eventTimes[index] + heartbeatTime;
+    }
+
+    /** @brief Get the time a sensor is next due for a reading
+     *
+     *  @param[in] index - index of the sensor
+     *
+     *  @return CLOCK_MONOTONIC microseconds, 0 if never read
+     */
+    uint64_t getDueTime(size_t index) const
+    {
+        if (isEventDriven(index))
+        {
+            auto lastTime =
+                timeStamps[index] ? timeStamps[index] : eventTimes[index];
+            return lastTime + std::max(heartbeatTime, pollIntervals[index]);
+        }
+        if (!timeStamps[index])
+        {
+            return 0;
+        }
+        return timeStamps[index] + pollIntervals[index];
+    }
+
+    /** @brief Adapt the polling interval of a sensor to its last reading
+     *
+     *  @param[in] index - index of the sensor
+     *  @param[in] steady - whether the reading is steady compared to
+     *                      steadyRawValues
+     *  @param[in] rawValue - raw reading, not a number if the reading failed
+     */
+    void adaptPollInterval(size_t index, bool steady, double rawValue)
+    {
+        if (!steady)
+        {
+            /* the reading starts a new steady run */
+            steadyRawValues[index] = rawValue;
+            steadyCycles[index] = 0;
+            pollIntervals[index] = updateTimes[index];
+            return;
+        }
+        if (!adaptiveCycles)
+        {
+            return;
+        }
+        if (++steadyCycles[index] < adaptiveCycles)
+        {
+            return;
+        }
+        steadyCycles[index] = 0;
+        pollIntervals[index] =
+            std::min(pollIntervals[index] * 2,
+                     std::max(maxPollInterval, updateTimes[index]));
+    }
+
+    /** @brief Record a completed reading
+     *
+     *  @param[in] index - index of the sensor
+     *  @param[in] rawValue - raw reading, not a number if the sensor is not
+     *                        enabled
+     *  @param[in] now - CLOCK_MONOTONIC microseconds
+     */
+    void recordReading(size_t index, double rawValue, uint64_t now)
+    {
+        rawValues[index] = rawValue;
+        timeStamps[index] = now;
+        statuses[index] = std::isfinite(rawValue) ? readingValid : 0;
+    }
+
+    /** @brief Record the reading of a numeric sensor event
+     *
+     *  @param[in] index - index of the sensor
+     *  @param[in] rawValue - raw reading of the event
+     *  @param[in] now - CLOCK_MONOTONIC microseconds
+     */
+    void recordEvent(size_t index, double rawValue, uint64_t now)
+    {
+        rawValues[index] = rawValue;
+        eventTimes[index] = now;
+        statuses[index] = std::isfinite(rawValue) ? readingValid : 0;
+    }
+
+    /** @brief Record a failed reading
+     *
+     *  @param[in] index - index of the sensor
+     */
+    void recordFailure(size_t index)
+    {
+        statuses[index] |= readFailed;
+    }
+
+    /** @brief Convert the last raw values of all the sensors
+     *
+     *  @param[out] values - the values in the sensor units, one per sensor
+     */
+    void convert(std::span<double> values) const
+    {
+        convertReadings(rawValues, scales, biases, values);
+    }
+
+    std::vector<uint16_t> sensorIds;     //!< PDR sensor IDs
+    std::vector<uint64_t> updateTimes;   //!< update intervals in usec
+    std::vector<uint64_t> pollIntervals; //!< polling intervals in usec
+    std::vector<uint16_t> steadyCycles;  //!< steady readings in a row
+    std::vector<double> steadyRawValues; //!< raw values starting the runs
+    std::vector<uint64_t> timeStamps;    //!< last successful readings in usec
+    std::vector<uint64_t> eventTimes;    //!< last numeric sensor events in usec
+    std::vector<double> rawValues;       //!< last raw values
+    std::vector<double> scales;          //!< SensorConversion::scale
+    std::vector<double> biases;          //!< SensorConversion::bias
+    std::vector<uint8_t> statuses;       //!< bitmask of Status
+
+    /** @brief Polling interval of the event driven sensors in usec, 0 polls
+     *         them at their update interval */
+    uint64_t heartbeatTime =
+        static_cast<uint64_t>(SENSOR_EVENT_HEARTBEAT_INTERVAL) * 1000;
+
+    /** @brief Steady readings in a row doubling the polling interval, 0
+     *         polls the sensors at their update interval */
+    uint16_t adaptiveCycles = SENSOR_POLLING_ADAPTIVE_CYCLES;
+
+    /** @brief Longest polling interval of the adaptive polling in usec */
+    uint64_t maxPollInterval =
+        static_cast<uint64_t>(SENSOR_POLLING_ADAPTIVE_MAX_INTERVAL) * 1000;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -118,106 +118,231 @@ bool Terminus::createInventoryPath(std::string tName)
     return false;
 }
 
-void Terminus::parseTerminusPDRs()
+/** @brief Get the record handle of a PDR
+ *
+ *  @param[in] pdr - the PDR from GetPDR command
+ *  @return the record handle, std::nullopt if the PDR is too short
+ */
+static std::optional<uint32_t> getPdrRecordHandle(std::span<const uint8_t> pdr)
 {
-    for (auto& pdr : pdrs)
+    if (pdr.size() < sizeof(pldm_pdr_hdr))
     {
-        auto pdrHdr = new (pdr.data()) pldm_pdr_hdr;
-        switch (pdrHdr->type)
+        return std::nullopt;
+    }
+    auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
+    return le32toh(pdrHdr->record_handle);
+}
+
+/** @brief Get the sensor ID of a numeric sensor, compact numeric sensor or
+ *         sensor auxiliary names PDR, which all start with the PDR header,
+ *         the terminus handle and the sensor ID
+ *
+ *  @param[in] pdr - the PDR from GetPDR command
+ *  @return the sensor ID, std::nullopt for the other PDR types
+ */
+static std::optional<SensorId> getPdrSensorId(std::span<const uint8_t> pdr)
+{
+    constexpr auto offset = sizeof(pldm_pdr_hdr) + sizeof(uint16_t);
+    if (pdr.size() < offset + sizeof(SensorId))
+    {
+        return std::nullopt;
+    }
+    auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
+    if (pdrHdr->type != PLDM_NUMERIC_SENSOR_PDR &&
+        pdrHdr->type != PLDM_COMPACT_NUMERIC_SENSOR_PDR &&
+        pdrHdr->type != PLDM_SENSOR_AUXILIARY_NAMES_PDR)
+    {
+        return std::nullopt;
+    }
+    SensorId sensorId = 0;
+    memcpy(&sensorId, pdr.data() + offset, sizeof(sensorId));
+    return le16toh(sensorId);
+}
+
+void Terminus::parsePDR(std::span<const uint8_t> pdr)
+{
+    auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
+    switch (pdrHdr->type)
+    {
+        case PLDM_SENSOR_AUXILIARY_NAMES_PDR:
         {
-            case PLDM_SENSOR_AUXILIARY_NAMES_PDR:
+            auto sensorAuxNames = parseSensorAuxiliaryNamesPDR(pdr);
+            if (!sensorAuxNames)
             {
-                auto sensorAuxNames = parseSensorAuxiliaryNamesPDR(pdr);
-                if (!sensorAuxNames)
-                {
-                    lg2::error(
-                        "Failed to parse PDR with type {TYPE} handle {HANDLE}",
-                        "TYPE", pdrHdr->type, "HANDLE",
-                        static_cast<uint32_t>(pdrHdr->record_handle));
-                    continue;
-                }
-                sensorAuxiliaryNamesTbl.emplace_back(std::move(sensorAuxNames));
-                break;
+                lg2::error(
+                    "Failed to parse PDR with type {TYPE} handle {HANDLE}",
+                    "TYPE", pdrHdr->type, "HANDLE",
+                    static_cast<uint32_t>(pdrHdr->record_handle));
+                return;
             }
-            case PLDM_NUMERIC_SENSOR_PDR:
+            sensorAuxiliaryNamesTbl.emplace_back(std::move(sensorAuxNames));
+            break;
+        }
+        case PLDM_NUMERIC_SENSOR_PDR:
+        {
+            auto parsedPdr = parseNumericSensorPDR(pdr);
+            if (!parsedPdr)
             {
-                auto parsedPdr = parseNumericSensorPDR(pdr);
-                if (!parsedPdr)
-                {
-                    lg2::error(
-                        "Failed to parse PDR with type {TYPE} handle {HANDLE}",
-                        "TYPE", pdrHdr->type, "HANDLE",
-                        static_cast<uint32_t>(pdrHdr->record_handle));
-                    continue;
-                }
-                numericSensorPdrs.emplace_back(std::move(parsedPdr));
-                break;
+                lg2::error(
+                    "Failed to parse PDR with type {TYPE} handle {HANDLE}",
+                    "TYPE", pdrHdr->type, "HANDLE",
+                    static_cast<uint32_t>(pdrHdr->record_handle));
+                return;
             }
-            case PLDM_COMPACT_NUMERIC_SENSOR_PDR:
+            numericSensorPdrs.emplace_back(std::move(parsedPdr));
+            break;
+        }
+        case PLDM_COMPACT_NUMERIC_SENSOR_PDR:
+        {
+            auto parsedPdr = parseCompactNumericSensorPDR(pdr);
+            if (!parsedPdr)
             {
-                auto parsedPdr = parseCompactNumericSensorPDR(pdr);
-                if (!parsedPdr)
-                {
-                    lg2::error(
-                        "Failed to parse PDR with type {TYPE} handle {HANDLE}",
-                        "TYPE", pdrHdr->type, "HANDLE",
-                        static_cast<uint32_t>(pdrHdr->record_handle));
-                    continue;
-                }
-                auto sensorAuxNames = parseCompactNumericSensorNames(pdr);
-                if (!sensorAuxNames)
-                {
-                    lg2::error(
-                        "Failed to parse sensor name PDR with type {TYPE} handle {HANDLE}",
-                        "TYPE", pdrHdr->type, "HANDLE",
-                        static_cast<uint32_t>(pdrHdr->record_handle));
-                    continue;
-                }
-                compactNumericSensorPdrs.emplace_back(std::move(parsedPdr));
-                sensorAuxiliaryNamesTbl.emplace_back(std::move(sensorAuxNames));
-                break;
+                lg2::error(
+                    "Failed to parse PDR with type {TYPE} handle {HANDLE}",
+                    "TYPE", pdrHdr->type, "HANDLE",
+                    static_cast<uint32_t>(pdrHdr->record_handle));
+                return;
             }
-            case PLDM_ENTITY_AUXILIARY_NAMES_PDR:
+            auto sensorAuxNames = parseCompactNumericSensorNames(pdr);
+            if (!sensorAuxNames)
             {
-                auto entityNames = parseEntityAuxiliaryNamesPDR(pdr);
-                if (!entityNames)
-                {
-                    lg2::error(
-                        "Failed to parse sensor name PDR with type {TYPE} handle {HANDLE}",
-                        "TYPE", pdrHdr->type, "HANDLE",
-                        static_cast<uint32_t>(pdrHdr->record_handle));
-                    continue;
-                }
-                entityAuxiliaryNamesTbl.emplace_back(std::move(entityNames));
-                break;
+                lg2::error(
+                    "Failed to parse sensor name PDR with type {TYPE} handle {HANDLE}",
+                    "TYPE", pdrHdr->type, "HANDLE",
+                    static_cast<uint32_t>(pdrHdr->record_handle));
+                return;
             }
-            case PLDM_REDFISH_RESOURCE_PDR:
+            compactNumericSensorPdrs.emplace_back(std::move(parsedPdr));
+            sensorAuxiliaryNamesTbl.emplace_back(std::move(sensorAuxNames));
+            break;
+        }
+        case PLDM_ENTITY_AUXILIARY_NAMES_PDR:
+        {
+            auto entityNames = parseEntityAuxiliaryNamesPDR(pdr);
+            if (!entityNames)
             {
-                auto parsedPdr = parseRedfishResourcePDR(pdr);
-                if (!parsedPdr)
-                {
-                    lg2::error(
-                        "Failed to parse PDR with type {TYPE} handle {HANDLE}",
-                        "TYPE", pdrHdr->type, "HANDLE",
-                        static_cast<uint32_t>(pdrHdr->record_handle));
-                    continue;
-                }
-                redfishResourcePdrs.emplace_back(std::move(parsedPdr));
-                redfishResourcePdrsRaw.emplace_back(pdr);
-                break;
+                lg2::error(
+                    "Failed to parse sensor name PDR with type {TYPE} handle {HANDLE}",
+                    "TYPE", pdrHdr->type, "HANDLE",
+                    static_cast<uint32_t>(pdrHdr->record_handle));
+                return;
+            }
+            entityAuxiliaryNamesTbl.emplace_back(std::move(entityNames));
+            break;
+        }
+        case PLDM_REDFISH_RESOURCE_PDR:
+        {
+            auto parsedPdr = parseRedfishResourcePDR(pdr);
+            if (!parsedPdr)
+            {
+                lg2::error(
+                    "Failed to parse PDR with type {TYPE} handle {HANDLE}",
+                    "TYPE", pdrHdr->type, "HANDLE",
+                    static_cast<uint32_t>(pdrHdr->record_handle));
+                return;
             }
-            default:
+            redfishResourcePdrs.emplace_back(std::move(parsedPdr));
+            redfishResourcePdrsRaw.emplace_back(pdr.begin(), pdr.end());
+            break;
+        }
+        default:
+        {
+            lg2::error("Unsupported PDR with type {TYPE} handle {HANDLE}",
+                       "TYPE", pdrHdr->type, "HANDLE",
+                       static_cast<uint32_t>(pdrHdr->record_handle));
+            break;
+        }
+    }
+}
+
+void Terminus::parseTerminusPDRs()
+{
+    for (auto pdr : pdrs)
+    {
+        parsePDR(pdr);
+    }
+
+    completeTerminusPDRs();
+}
+
+void Terminus::addTerminusPDR(std::span<const uint8_t> pdr)
+{
+    if (pdr.size() < sizeof(pldm_pdr_hdr))
+    {
+        return;
+    }
+    pdrs.emplace_back(pdr);
+    parsePDR(pdr);
+
+    if (terminusName.empty())
+    {
+        auto tName = findTerminusName();
+        if (!tName || tName.value().empty())
+        {
+            /* The sensor names start with the terminus name */
+            return;
+        }
+        lg2::info("Terminus {TID} has Auxiliary Name {NAME}.", "TID", tid,
+                  "NAME", tName.value());
+        terminusName = static_cast<std::string>(tName.value());
+        if (createInventoryPath(terminusName))
+        {
+            lg2::info("Terminus ID {TID}: Created Inventory path {PATH}.",
+                      "TID", tid, "PATH", inventoryPath);
+        }
+
+        /* Create the sensors received before the terminus name */
+        for (const auto& sensorPdr : numericSensorPdrs)
+        {
+            if (getSensorAuxiliaryNames(sensorPdr->sensor_id))
             {
-                lg2::error("Unsupported PDR with type {TYPE} handle {HANDLE}",
-                           "TYPE", pdrHdr->type, "HANDLE",
-                           static_cast<uint32_t>(pdrHdr->record_handle));
-                break;
+                createNumericSensor(sensorPdr);
             }
         }
+        for (const auto& sensorPdr : compactNumericSensorPdrs)
+        {
+            createCompactNumericSensor(sensorPdr);
+        }
+        return;
+    }
+
+    auto sensorId = getPdrSensorId(pdr);
+    if (!sensorId)
+    {
+        return;
     }
 
+    /* A numeric sensor without auxiliary names yet may get them in a later
+     * PDR, it is created by completeTerminusPDRs otherwise */
+    auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
+    if (pdrHdr->type == PLDM_NUMERIC_SENSOR_PDR &&
+        !getSensorAuxiliaryNames(*sensorId))
+    {
+        return;
+    }
+    createSensor(*sensorId);
+}
+
+void Terminus::resetTerminusPDRs()
+{
+    sensorCreationEvent.reset();
+    sensorPdrIt = 0;
+    numericSensors.clear();
+    numericSensorTable = SensorTable{};
+    numericSensorHistory = SensorHistory{};
+    pdrs.clear();
+    numericSensorPdrs.clear();
+    compactNumericSensorPdrs.clear();
+    sensorAuxiliaryNamesTbl.clear();
+    entityAuxiliaryNamesTbl.clear();
+    redfishResourcePdrs.clear();
+    redfishResourcePdrsRaw.clear();
+}
+
+void Terminus::completeTerminusPDRs()
+{
     auto tName = findTerminusName();
-    if (tName && !tName.value().empty())
+    if (tName && !tName.value().empty() && tName.value() != terminusName)
     {
         lg2::info("Terminus {TID} has Auxiliary Name {NAME}.", "TID", tid,
                   "NAME", tName.value());
@@ -242,6 +367,183 @@ void Terminus::parseTerminusPDRs()
     addNextSensorFromPDRs();
 }
 
+void Terminus::unparsePDR(std::span<const uint8_t> pdr)
+{
+    auto handle = getPdrRecordHandle(pdr);
+    if (!handle)
+    {
+        return;
+    }
+    auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
+    switch (pdrHdr->type)
+    {
+        case PLDM_NUMERIC_SENSOR_PDR:
+            std::erase_if(numericSensorPdrs, [&handle](const auto& parsedPdr) {
+                return parsedPdr->hdr.record_handle == *handle;
+            });
+            break;
+        case PLDM_COMPACT_NUMERIC_SENSOR_PDR:
+            /* The parsed header is copied from the PDR */
+            std::erase_if(compactNumericSensorPdrs,
+                          [&handle](const auto& parsedPdr) {
+                              return le32toh(parsedPdr->hdr.record_handle) ==
+                                     *handle;
+                          });
+            [[fallthrough]];
+        case PLDM_SENSOR_AUXILIARY_NAMES_PDR:
+        {
+            auto sensorId = getPdrSensorId(pdr);
+            std::erase_if(sensorAuxiliaryNamesTbl,
+                          [&sensorId](const auto& sensorAuxNames) {
+                              return sensorId && sensorAuxNames &&
+                                     std::get<0>(*sensorAuxNames) == *sensorId;
+                          });
+            break;
+        }
+        case PLDM_ENTITY_AUXILIARY_NAMES_PDR:
+        {
+            auto entityNames = parseEntityAuxiliaryNamesPDR(pdr);
+            std::erase_if(entityAuxiliaryNamesTbl,
+                          [&entityNames](const auto& names) {
+                              return entityNames && names &&
+                                     std::get<0>(*names) ==
+                                         std::get<0>(*entityNames);
+                          });
+            break;
+        }
+        case PLDM_REDFISH_RESOURCE_PDR:
+        {
+            /* The parsed and raw lists are filled together */
+            auto it = std::ranges::find_if(
+                redfishResourcePdrsRaw, [&pdr](const auto& raw) {
+                    return std::ranges::equal(raw, pdr);
+                });
+            if (it != redfishResourcePdrsRaw.end())
+            {
+                auto index = it - redfishResourcePdrsRaw.begin();
+                redfishResourcePdrsRaw.erase(it);
+                if (static_cast<size_t>(index) < redfishResourcePdrs.size())
+                {
+                    redfishResourcePdrs.erase(redfishResourcePdrs.begin() +
+                                              index);
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void Terminus::updateTerminusPDRs(
+    const std::set<uint32_t>& deletedHandles,
+    std::vector<std::vector<uint8_t>>&& changedPdrs)
+{
+    /* A modified PDR replaces the PDR with the same record handle */
+    auto removedHandles = deletedHandles;
+    for (const auto& pdr : changedPdrs)
+    {
+        if (auto handle = getPdrRecordHandle(pdr))
+        {
+            removedHandles.insert(*handle);
+        }
+    }
+
+    /* The sensors whose PDR or auxiliary names are removed or added */
+    std::set<SensorId> sensorIds;
+    pdrs.eraseIf([&](std::span<const uint8_t> pdr) {
+        auto handle = getPdrRecordHandle(pdr);
+        if (!handle || !removedHandles.contains(*handle))
+        {
+            return false;
+        }
+        if (auto sensorId = getPdrSensorId(pdr))
+        {
+            sensorIds.insert(*sensorId);
+        }
+        unparsePDR(pdr);
+        return true;
+    });
+
+    for (auto& pdr : changedPdrs)
+    {
+        if (pdr.size() < sizeof(pldm_pdr_hdr))
+        {
+            continue;
+        }
+        if (auto sensorId = getPdrSensorId(pdr))
+        {
+            sensorIds.insert(*sensorId);
+        }
+        parsePDR(pdr);
+        pdrs.emplace_back(pdr);
+    }
+
+    lg2::info(
+        "Terminus ID {TID}: Updated {REMOVED} PDRs, affecting {COUNT} sensors.",
+        "TID", tid, "REMOVED", removedHandles.size(), "COUNT",
+        sensorIds.size());
+
+    if (terminusName.empty())
+    {
+        return;
+    }
+
+    /* The deferred sensor creation iterates the parsed PDR lists which just
+     * changed, so create all the sensors again */
+    if (sensorCreationEvent)
+    {
+        sensorCreationEvent.reset();
+        numericSensors.clear();
+        numericSensorTable = SensorTable{};
+        numericSensorHistory = SensorHistory{};
+        sensorPdrIt = 0;
+        addNextSensorFromPDRs();
+        return;
+    }
+
+    for (auto sensorId : sensorIds)
+    {
+        removeNumericSensor(sensorId);
+        createSensor(sensorId);
+    }
+}
+
+void Terminus::createSensor(SensorId id)
+{
+    auto numericPdr = std::ranges::find_if(
+        numericSensorPdrs,
+        [id](const auto& pdr) { return pdr->sensor_id == id; });
+    if (numericPdr != numericSensorPdrs.end())
+    {
+        createNumericSensor(*numericPdr);
+        return;
+    }
+
+    auto compactPdr = std::ranges::find_if(
+        compactNumericSensorPdrs,
+        [id](const auto& pdr) { return pdr->sensor_id == id; });
+    if (compactPdr != compactNumericSensorPdrs.end())
+    {
+        createCompactNumericSensor(*compactPdr);
+    }
+}
+
+void Terminus::removeNumericSensor(SensorId id)
+{
+    auto index = numericSensorTable.find(id);
+    if (!index || *index >= numericSensors.size())
+    {
+        return;
+    }
+
+    lg2::info("Removed NumericSensor {NAME}", "NAME",
+              numericSensors[*index]->sensorName);
+    numericSensors.erase(numericSensors.begin() + *index);
+    numericSensorTable.remove(*index);
+    numericSensorHistory.remove(*index);
+}
+
 void Terminus::addNextSensorFromPDRs()
 {
     sensorCreationEvent.reset();
@@ -303,7 +605,7 @@ std::shared_ptr<SensorAuxiliaryNames> Terminus::getSensorAuxiliaryNames(
 };
 
 std::shared_ptr<SensorAuxiliaryNames> Terminus::parseSensorAuxiliaryNamesPDR(
-    const std::vector<uint8_t>& pdrData)
+    std::span<const uint8_t> pdrData)
 {
     constexpr uint8_t nullTerminator = 0;
     auto pdr = reinterpret_cast<const struct pldm_sensor_auxiliary_names_pdr*>(
@@ -358,7 +660,7 @@ std::shared_ptr<SensorAuxiliaryNames> Terminus::parseSensorAuxiliaryNamesPDR(
 }
 
 std::shared_ptr<EntityAuxiliaryNames> Terminus::parseEntityAuxiliaryNamesPDR(
-    const std::vector<uint8_t>& pdrData)
+    std::span<const uint8_t> pdrData)
 {
     auto names_offset = sizeof(struct pldm_pdr_hdr) +
                         PLDM_PDR_ENTITY_AUXILIARY_NAME_PDR_MIN_LENGTH;
@@ -420,7 +722,7 @@ std::shared_ptr<EntityAuxiliaryNames> Terminus::parseEntityAuxiliaryNamesPDR(
 }
 
 std::shared_ptr<pldm_numeric_sensor_value_pdr> Terminus::parseNumericSensorPDR(
-    const std::vector<uint8_t>& pdr)
+    std::span<const uint8_t> pdr)
 {
     const uint8_t* ptr = pdr.data();
     auto parsedPdr = std::make_shared<pldm_numeric_sensor_value_pdr>();
@@ -433,7 +735,7 @@ std::shared_ptr<pldm_numeric_sensor_value_pdr> Terminus::parseNumericSensorPDR(
 }
 
 std::shared_ptr<pldm_redfish_resource_pdr> Terminus::parseRedfishResourcePDR(
-    const std::vector<uint8_t>& pdr)
+    std::span<const uint8_t> pdr)
 {
     const uint8_t* ptr = pdr.data();
     auto parsedPdr = std::make_shared<pldm_redfish_resource_pdr>();
@@ -448,16 +750,28 @@ std::shared_ptr<pldm_redfish_resource_pdr> Terminus::parseRedfishResourcePDR(
 
 void Terminus::addNumericSensor(
     const std::shared_ptr<pldm_numeric_sensor_value_pdr> pdr)
+{
+    createNumericSensor(pdr);
+    addNextSensorFromPDRs();
+}
+
+void Terminus::createNumericSensor(
+    const std::shared_ptr<pldm_numeric_sensor_value_pdr>& pdr)
 {
     if (!pdr)
     {
         lg2::error(
             "Terminus ID {TID}: Skip adding Numeric Sensor - invalid pointer to PDR.",
             "TID", tid);
-        addNextSensorFromPDRs();
+        return;
     }
 
     auto sensorId = pdr->sensor_id;
+    if (numericSensorTable.find(sensorId))
+    {
+        /* Created as soon as its PDR was received */
+        return;
+    }
     auto sensorNames = getSensorNames(sensorId);
 
     if (sensorNames.empty())
@@ -465,7 +779,7 @@ void Terminus::addNumericSensor(
         lg2::error(
             "Terminus ID {TID}: Failed to get name for Numeric Sensor {SID}",
             "TID", tid, "SID", sensorId);
-        addNextSensorFromPDRs();
+        return;
     }
 
     std::string sensorName = sensorNames.front();
@@ -476,6 +790,9 @@ void Terminus::addNumericSensor(
             tid, true, pdr, sensorName, inventoryPath);
         lg2::info("Created NumericSensor {NAME}", "NAME", sensorName);
         numericSensors.emplace_back(sensor);
+        numericSensorTable.add(sensor->sensorId, sensor->updateTime,
+                               sensor->getConversion());
+        numericSensorHistory.add();
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -483,12 +800,10 @@ void Terminus::addNumericSensor(
             "Failed to create NumericSensor. error - {ERROR} sensorname - {NAME}",
             "ERROR", e, "NAME", sensorName);
     }
-
-    addNextSensorFromPDRs();
 }
 
 std::shared_ptr<SensorAuxiliaryNames> Terminus::parseCompactNumericSensorNames(
-    const std::vector<uint8_t>& sPdr)
+    std::span<const uint8_t> sPdr)
 {
     std::vector<std::vector<std::pair<NameLanguageTag, SensorName>>>
         sensorAuxNames{};
@@ -521,7 +836,7 @@ std::shared_ptr<SensorAuxiliaryNames> Terminus::parseCompactNumericSensorNames(
 }
 
 std::shared_ptr<pldm_compact_numeric_sensor_pdr>
-    Terminus::parseCompactNumericSensorPDR(const std::vector<uint8_t>& sPdr)
+    Terminus::parseCompactNumericSensorPDR(std::span<const uint8_t> sPdr)
 {
     auto pdr =
         reinterpret_cast<const pldm_compact_numeric_sensor_pdr*>(sPdr.data());
@@ -554,16 +869,28 @@ std::shared_ptr<pldm_compact_numeric_sensor_pdr>
 
 void Terminus::addCompactNumericSensor(
     const std::shared_ptr<pldm_compact_numeric_sensor_pdr> pdr)
+{
+    createCompactNumericSensor(pdr);
+    addNextSensorFromPDRs();
+}
+
+void Terminus::createCompactNumericSensor(
+    const std::shared_ptr<pldm_compact_numeric_sensor_pdr>& pdr)
 {
     if (!pdr)
     {
         lg2::error(
             "Terminus ID {TID}: Skip adding Compact Numeric Sensor - invalid pointer to PDR.",
             "TID", tid);
-        addNextSensorFromPDRs();
+        return;
     }
 
     auto sensorId = pdr->sensor_id;
+    if (numericSensorTable.find(sensorId))
+    {
+        /* Created as soon as its PDR was received */
+        return;
+    }
     auto sensorNames = getSensorNames(sensorId);
 
     if (sensorNames.empty())
@@ -571,7 +898,7 @@ void Terminus::addCompactNumericSensor(
         lg2::error(
             "Terminus ID {TID}: Failed to get name for Compact Numeric Sensor {SID}",
             "TID", tid, "SID", sensorId);
-        addNextSensorFromPDRs();
+        return;
     }
 
     std::string sensorName = sensorNames.front();
@@ -582,6 +909,9 @@ void Terminus::addCompactNumericSensor(
             tid, true, pdr, sensorName, inventoryPath);
         lg2::info("Created Compact NumericSensor {NAME}", "NAME", sensorName);
         numericSensors.emplace_back(sensor);
+        numericSensorTable.add(sensor->sensorId, sensor->updateTime,
+                               sensor->getConversion());
+        numericSensorHistory.add();
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -589,8 +919,6 @@ void Terminus::addCompactNumericSensor(
             "Failed to create Compact NumericSensor. error - {ERROR} sensorname - {NAME}",
             "ERROR", e, "NAME", sensorName);
     }
-
-    addNextSensorFromPDRs();
 }
 
 std::shared_ptr<NumericSensor> Terminus::getSensorObject(SensorId id)
@@ -609,20 +937,13 @@ std::shared_ptr<NumericSensor> Terminus::getSensorObject(SensorId id)
         return nullptr;
     }
 
-    for (auto& sensor : numericSensors)
+    auto index = numericSensorTable.find(id);
+    if (!index || *index >= numericSensors.size())
     {
-        if (!sensor)
-        {
-            continue;
-        }
-
-        if (sensor->sensorId == id)
-        {
-            return sensor;
-        }
+        return nullptr;
     }
 
-    return nullptr;
+    return numericSensors[*index];
 }
 
 /** @brief Check if a pointer is go through end of table
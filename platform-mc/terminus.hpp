@@ -3,7 +3,10 @@
 #include "common/types.hpp"
 #include "dbus_impl_fru.hpp"
 #include "numeric_sensor.hpp"
+#include "pdr_arena.hpp"
 #include "requester/handler.hpp"
+#include "sensor_history.hpp"
+#include "sensor_table.hpp"
 #include "terminus.hpp"
 
 #include <libpldm/fru.h>
@@ -14,6 +17,8 @@
 
 #include <algorithm>
 #include <bitset>
+#include <set>
+#include <span>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -59,6 +64,51 @@ using AuxiliaryNames = std::vector<std::pair<NameLanguageTag, std::string>>;
 using EntityKey = struct EntityKey;
 using EntityAuxiliaryNames = std::tuple<EntityKey, AuxiliaryNames>;
 
+/** @struct PdrChanges
+ *
+ *  The changes of the PDR repository of a terminus signaled by
+ *  pldmPDRRepositoryChgEvent events and not applied yet.
+ */
+struct PdrChanges
+{
+    /** @brief The changed records are not known, compare the whole
+     *         repository */
+    bool refreshAll = false;
+
+    std::set<uint32_t> deletedHandles; //!< handles of the deleted PDRs
+    std::set<uint32_t> changedHandles; //!< handles of the added/modified PDRs
+
+    /** @brief Check if there is no change to apply */
+    bool empty() const
+    {
+        return !refreshAll && deletedHandles.empty() && changedHandles.empty();
+    }
+
+    /** @brief Merge the changes signaled before these changes, which were
+     *         not applied
+     *
+     *  @param[in] older - the changes signaled before
+     */
+    void mergeOlder(const PdrChanges& older)
+    {
+        refreshAll = refreshAll || older.refreshAll;
+        for (auto handle : older.deletedHandles)
+        {
+            if (!changedHandles.contains(handle))
+            {
+                deletedHandles.insert(handle);
+            }
+        }
+        for (auto handle : older.changedHandles)
+        {
+            if (!deletedHandles.contains(handle))
+            {
+                changedHandles.insert(handle);
+            }
+        }
+    }
+};
+
 /**
  * @brief Terminus
  *
@@ -133,6 +183,34 @@ class Terminus
      */
     void parseTerminusPDRs();
 
+    /** @brief Store and parse a PDR as soon as it is received. The sensor of
+     *         the PDR is created once its name is known: the terminus name
+     *         and, for a numeric sensor, its sensor auxiliary names.
+     *
+     *  @param[in] pdr - the PDR from GetPDR command
+     */
+    void addTerminusPDR(std::span<const uint8_t> pdr);
+
+    /** @brief Create the sensors not created by addTerminusPDR once all the
+     *         PDRs are received
+     */
+    void completeTerminusPDRs();
+
+    /** @brief Remove the PDRs, the parsed PDRs and the sensors before
+     *         receiving the PDRs again
+     */
+    void resetTerminusPDRs();
+
+    /** @brief Apply changes of the PDR repository to pdrs and to the parsed
+     *         PDRs. Only the numeric sensors whose PDR or auxiliary names
+     *         were deleted, added or modified are removed or created again.
+     *
+     *  @param[in] deletedHandles - record handles of the deleted PDRs
+     *  @param[in] changedPdrs - the added or modified PDRs
+     */
+    void updateTerminusPDRs(const std::set<uint32_t>& deletedHandles,
+                            std::vector<std::vector<uint8_t>>&& changedPdrs);
+
     /** @brief The getter to return terminus's TID */
     pldm_tid_t getTid()
     {
@@ -157,7 +235,10 @@ class Terminus
     void updateInventoryWithFru(const uint8_t* fruData, const size_t fruLen);
 
     /** @brief A list of PDRs fetched from Terminus */
-    std::vector<std::vector<uint8_t>> pdrs{};
+    PdrArena pdrs{};
+
+    /** @brief The PDR repository changes to fetch and apply */
+    PdrChanges pdrChanges{};
 
     /** @brief A flag to indicate if terminus has been initialized */
     bool initialized = false;
@@ -173,6 +254,12 @@ class Terminus
     /** @brief A list of numericSensors */
     std::vector<std::shared_ptr<NumericSensor>> numericSensors{};
 
+    /** @brief Polling state of numericSensors, indexed like numericSensors */
+    SensorTable numericSensorTable{};
+
+    /** @brief Recent readings of numericSensors, indexed like numericSensors */
+    SensorHistory numericSensorHistory{};
+
     /** @brief The flag indicates that the terminus FIFO contains a large
      *         message that will require a multipart transfer via the
      *         PollForPlatformEvent command
@@ -226,6 +313,18 @@ class Terminus
      */
     std::optional<std::string_view> findTerminusName();
 
+    /** @brief Parse a PDR into the parsed PDR lists
+     *
+     *  @param[in] pdr - the PDR from GetPDR command
+     */
+    void parsePDR(std::span<const uint8_t> pdr);
+
+    /** @brief Remove a PDR from the parsed PDR lists
+     *
+     *  @param[in] pdr - the PDR from GetPDR command
+     */
+    void unparsePDR(std::span<const uint8_t> pdr);
+
     /** @brief Construct the NumericSensor sensor class for the PLDM sensor.
      *         The NumericSensor class will handle create D-Bus object path,
      *         provide the APIs to update sensor value, threshold...
@@ -235,13 +334,20 @@ class Terminus
     void addNumericSensor(
         const std::shared_ptr<pldm_numeric_sensor_value_pdr> pdr);
 
+    /** @brief Create the NumericSensor of a numeric sensor PDR
+     *
+     *  @param[in] pdr - the numeric sensor PDR info
+     */
+    void createNumericSensor(
+        const std::shared_ptr<pldm_numeric_sensor_value_pdr>& pdr);
+
     /** @brief Parse the numeric sensor PDRs
      *
      *  @param[in] pdrData - the response PDRs from GetPDR command
      *  @return pointer to numeric sensor info struct
      */
     std::shared_ptr<pldm_numeric_sensor_value_pdr> parseNumericSensorPDR(
-        const std::vector<uint8_t>& pdrData);
+        std::span<const uint8_t> pdrData);
 
     /** @brief Parse the sensor Auxiliary name PDRs
      *
@@ -249,7 +355,7 @@ class Terminus
      *  @return pointer to sensor Auxiliary name info struct
      */
     std::shared_ptr<SensorAuxiliaryNames> parseSensorAuxiliaryNamesPDR(
-        const std::vector<uint8_t>& pdrData);
+        std::span<const uint8_t> pdrData);
 
     /** @brief Parse the Entity Auxiliary name PDRs
      *
@@ -257,7 +363,7 @@ class Terminus
      *  @return pointer to Entity Auxiliary name info struct
      */
     std::shared_ptr<EntityAuxiliaryNames> parseEntityAuxiliaryNamesPDR(
-        const std::vector<uint8_t>& pdrData);
+        std::span<const uint8_t> pdrData);
 
     /** @brief Parse the redfish resource PDRs
      *
@@ -265,7 +371,7 @@ class Terminus
      *  @return pointer to redfish resource info struct
      */
     std::shared_ptr<pldm_redfish_resource_pdr> parseRedfishResourcePDR(
-        const std::vector<uint8_t>& pdrData);
+        std::span<const uint8_t> pdrData);
 
     /** @brief Construct the NumericSensor sensor class for the compact numeric
      *         PLDM sensor.
@@ -275,13 +381,33 @@ class Terminus
     void addCompactNumericSensor(
         const std::shared_ptr<pldm_compact_numeric_sensor_pdr> pdr);
 
+    /** @brief Create the NumericSensor of a compact numeric sensor PDR
+     *
+     *  @param[in] pdr - the compact numeric sensor PDR info
+     */
+    void createCompactNumericSensor(
+        const std::shared_ptr<pldm_compact_numeric_sensor_pdr>& pdr);
+
+    /** @brief Create the NumericSensor of a sensor ID from its numeric or
+     *         compact numeric sensor PDR, unless it exists
+     *
+     *  @param[in] id - sensor ID
+     */
+    void createSensor(SensorId id);
+
+    /** @brief Remove a NumericSensor and its polling state
+     *
+     *  @param[in] id - sensor ID
+     */
+    void removeNumericSensor(SensorId id);
+
     /** @brief Parse the compact numeric sensor PDRs
      *
      *  @param[in] pdrData - the response PDRs from GetPDR command
      *  @return pointer to compact numeric sensor info struct
      */
     std::shared_ptr<pldm_compact_numeric_sensor_pdr>
-        parseCompactNumericSensorPDR(const std::vector<uint8_t>& pdrData);
+        parseCompactNumericSensorPDR(std::span<const uint8_t> pdrData);
 
     /** @brief Parse the sensor Auxiliary name from compact numeric sensor PDRs
      *
@@ -289,7 +415,7 @@ class Terminus
      *  @return pointer to sensor Auxiliary name info struct
      */
     std::shared_ptr<SensorAuxiliaryNames> parseCompactNumericSensorNames(
-        const std::vector<uint8_t>& pdrData);
+        std::span<const uint8_t> pdrData);
 
     /** @brief Create the terminus inventory path to
      *         /xyz/openbmc_project/inventory/Item/Board/.
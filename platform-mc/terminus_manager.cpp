@@ -1,5 +1,6 @@
 #include "terminus_manager.hpp"
 
+#include "concurrency.hpp"
 #include "manager.hpp"
 
 #include <phosphor-logging/lg2.hpp>
@@ -186,6 +187,7 @@ TerminiMapper::iterator TerminusManager::findTerminusPtr(
 exec::task<int> TerminusManager::discoverMctpTerminusTask()
 {
     std::vector<pldm_tid_t> addedTids;
+    int rc = PLDM_SUCCESS;
     while (!queuedMctpInfos.empty())
     {
         if (manager)
@@ -194,21 +196,35 @@ exec::task<int> TerminusManager::discoverMctpTerminusTask()
         }
 
         const MctpInfos& mctpInfos = queuedMctpInfos.front();
+        MctpInfos newMctpInfos;
         for (const auto& mctpInfo : mctpInfos)
         {
-            auto it = findTerminusPtr(mctpInfo);
-            if (it == termini.end())
+            if (findTerminusPtr(mctpInfo) == termini.end())
             {
                 mctpInfoAvailTable[mctpInfo] = true;
-                co_await initMctpTerminus(mctpInfo);
+                newMctpInfos.emplace_back(mctpInfo);
             }
+        }
+
+        /* The endpoints are independent, initialize them concurrently */
+        co_await forEachConcurrently(
+            newMctpInfos, TERMINUS_INIT_MAX_CONCURRENCY,
+            [this](const MctpInfo& mctpInfo) {
+                return initMctpTerminus(mctpInfo);
+            });
 
-            /* Get TID of initialized terminus */
+        for (const auto& mctpInfo : mctpInfos)
+        {
+            /* Get TID of initialized terminus, the other endpoints of the
+             * list are still added when one failed */
             auto tid = toTid(mctpInfo);
             if (!tid)
             {
+                lg2::error("Failed to initialize terminus of EID {EID}.",
+                           "EID", std::get<0>(mctpInfo));
                 mctpInfoAvailTable.erase(mctpInfo);
-                co_return PLDM_ERROR;
+                rc = PLDM_ERROR;
+                continue;
             }
             addedTids.push_back(tid.value());
         }
@@ -221,7 +237,7 @@ exec::task<int> TerminusManager::discoverMctpTerminusTask()
         queuedMctpInfos.pop();
     }
 
-    co_return PLDM_SUCCESS;
+    co_return rc;
 }
 
 void TerminusManager::removeMctpTerminus(const MctpInfos& mctpInfos)
@@ -267,19 +283,23 @@ exec::task<int> TerminusManager::initMctpTerminus(const MctpInfo& mctpInfo)
     /* Terminus already has TID */
     if (tid != PLDM_TID_UNASSIGNED)
     {
-        /* TID is used by one discovered terminus */
-        auto it = termini.find(tid);
-        if (it != termini.end())
+        /* TID is mapped to one discovered terminus or to a terminus being
+         * initialized concurrently, the TID table is updated before any
+         * suspension so it is checked instead of the termini */
+        auto terminusMctpInfo = toMctpInfo(tid);
+        if (terminusMctpInfo)
         {
-            auto terminusMctpInfo = toMctpInfo(it->first);
-            /* The discovered terminus has the same MCTP Info */
-            if (terminusMctpInfo &&
-                (std::get<0>(terminusMctpInfo.value()) ==
+            /* The TID is already mapped to the MCTP Info */
+            if ((std::get<0>(terminusMctpInfo.value()) ==
                  std::get<0>(mctpInfo)) &&
                 (std::get<3>(terminusMctpInfo.value()) ==
                  std::get<3>(mctpInfo)))
             {
-                co_return PLDM_SUCCESS;
+                if (termini.contains(tid))
+                {
+                    co_return PLDM_SUCCESS;
+                }
+                isMapped = true;
             }
             else
             {
@@ -291,17 +311,11 @@ exec::task<int> TerminusManager::initMctpTerminus(const MctpInfo& mctpInfo)
                 isMapped = false;
             }
         }
-        /* Use the terminus TID for mapping */
+        /* Use the terminus TID for mapping, assign another TID when it is
+         * used */
         else
         {
-            auto mappedTid = storeTerminusInfo(mctpInfo, tid);
-            if (!mappedTid)
-            {
-                lg2::error("Failed to store Terminus Info for terminus {TID}.",
-                           "TID", tid);
-                co_return PLDM_ERROR;
-            }
-            isMapped = true;
+            isMapped = storeTerminusInfo(mctpInfo, tid).has_value();
         }
     }
 
@@ -18,6 +18,9 @@ class MockSensorManager : public SensorManager
         SensorManager(event, terminusManager, termini, manager) {};
 
     MOCK_METHOD(void, doSensorPolling, (pldm_tid_t tid), (override));
+
+    using SensorManager::emitSensorSignals;
+    using SensorManager::pendingSignalSensors;
 };
 
 } // namespace platform_mc
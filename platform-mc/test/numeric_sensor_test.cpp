@@ -101,6 +101,9 @@ TEST(NumericSensor, conversionFormula)
 
     // (40*1.5 + 1.0 ) * 10^1 = 610
     EXPECT_EQ(610, convertedValue);
+    EXPECT_EQ(610, sensor.toUnits(reading));
+    EXPECT_EQ(15, sensor.getConversion().scale);
+    EXPECT_EQ(10, sensor.getConversion().bias);
 }
 
 TEST(NumericSensor, checkThreshold)
@@ -270,3 +273,131 @@ TEST(NumericSensor, checkThreshold)
                                      hysteresis);
     EXPECT_EQ(false, lowAlarm);
 }
+
+TEST(NumericSensor, valueDeadband)
+{
+    std::vector<uint8_t> pdr1{
+        0x1,
+        0x0,
+        0x0,
+        0x0,                     // record handle
+        0x1,                     // PDRHeaderVersion
+        PLDM_NUMERIC_SENSOR_PDR, // PDRType
+        0x0,
+        0x0,                     // recordChangeNumber
+        PLDM_PDR_NUMERIC_SENSOR_PDR_FIXED_LENGTH +
+            PLDM_PDR_NUMERIC_SENSOR_PDR_VARIED_SENSOR_DATA_SIZE_MIN_LENGTH +
+            PLDM_PDR_NUMERIC_SENSOR_PDR_VARIED_RANGE_FIELD_MIN_LENGTH,
+        0,                             // dataLength
+        0,
+        0,                             // PLDMTerminusHandle
+        0x1,
+        0x0,                           // sensorID=1
+        PLDM_ENTITY_POWER_SUPPLY,
+        0,                             // entityType=Power Supply(120)
+        1,
+        0,                             // entityInstanceNumber
+        0x1,
+        0x0,                           // containerID=1
+        PLDM_NO_INIT,                  // sensorInit
+        false,                         // sensorAuxiliaryNamesPDR
+        PLDM_SENSOR_UNIT_DEGRESS_C,    // baseUint(2)=degrees C
+        1,                             // unitModifier = 1
+        0,                             // rateUnit
+        0,                             // baseOEMUnitHandle
+        0,                             // auxUnit
+        0,                             // auxUnitModifier
+        0,                             // auxRateUnit
+        0,                             // rel
+        0,                             // auxOEMUnitHandle
+        true,                          // isLinear
+        PLDM_RANGE_FIELD_FORMAT_SINT8, // sensorDataSize
+        0,
+        0,
+        0xc0,
+        0x3f, // resolution=1.5
+        0,
+        0,
+        0x80,
+        0x3f, // offset=1.0
+        0,
+        0,    // accuracy
+        0,    // plusTolerance
+        0,    // minusTolerance
+        2,    // hysteresis
+        0,    // supportedThresholds
+        0,    // thresholdAndHysteresisVolatility
+        0,
+        0,
+        0x80,
+        0x3f, // stateTransistionInterval=1.0
+        0,
+        0,
+        0x80,
+        0x3f,                          // updateInverval=1.0
+        255,                           // maxReadable
+        0,                             // minReadable
+        PLDM_RANGE_FIELD_FORMAT_UINT8, // rangeFieldFormat
+        0,                             // rangeFieldsupport
+        0,                             // nominalValue
+        0,                             // normalMax
+        0,                             // normalMin
+        0,                             // warningHigh
+        0,                             // warningLow
+        0,                             // criticalHigh
+        0,                             // criticalLow
+        0,                             // fatalHigh
+        0                              // fatalLow
+    };
+
+    auto numericSensorPdr = std::make_shared<pldm_numeric_sensor_value_pdr>();
+    auto rc = decode_numeric_sensor_pdr_data(pdr1.data(), pdr1.size(),
+                                             numericSensorPdr.get());
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    std::string sensorName{"test3"};
+    std::string inventoryPath{
+        "/xyz/openbmc_project/inventroy/Item/Board/PLDM_device_1"};
+    pldm::platform_mc::NumericSensor sensor(0x01, true, numericSensorPdr,
+                                            sensorName, inventoryPath);
+    sensor.setValueDeadband(100);
+
+    // (40*1.5 + 1.0 ) * 10^1 = 610 is published
+    sensor.updateReading(true, true, 40);
+    EXPECT_TRUE(sensor.hasPendingSignals());
+    sensor.emitPropertiesChanged();
+    EXPECT_FALSE(sensor.hasPendingSignals());
+
+    // 685 is within the deadband of 610
+    sensor.updateReading(true, true, 45);
+    EXPECT_FALSE(sensor.hasPendingSignals());
+
+    // 760 is outside the deadband of 610
+    sensor.updateReading(true, true, 50);
+    EXPECT_TRUE(sensor.hasPendingSignals());
+    sensor.emitPropertiesChanged();
+
+    // An unavailable sensor is always published
+    sensor.updateReading(false, true, 50);
+    EXPECT_TRUE(sensor.hasPendingSignals());
+    sensor.emitPropertiesChanged();
+    EXPECT_FALSE(sensor.hasPendingSignals());
+
+    // The deadband also bounds the steady readings of the adaptive polling
+    EXPECT_TRUE(sensor.isSteady(610, 685));
+    EXPECT_FALSE(sensor.isSteady(610, 760));
+    EXPECT_FALSE(
+        sensor.isSteady(std::numeric_limits<double>::quiet_NaN(), 610));
+}
+
+TEST(NumericSensor, convertReadings)
+{
+    std::vector<double> raw{40, -2, 0.5, 7};
+    std::vector<double> scales{15, 1, 0.1, 1000};
+    std::vector<double> biases{10, 0, 1, -5};
+    std::vector<double> values(raw.size());
+
+    pldm::platform_mc::convertReadings(raw, scales, biases, values);
+
+    EXPECT_EQ(values, (std::vector<double>{610, -2, 1.05, 6995}));
+}
@@ -0,0 +1,47 @@
+#include "platform-mc/pdr_arena.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+TEST(PdrArenaTest, appendAndErase)
+{
+    PdrArena pdrs;
+    EXPECT_TRUE(pdrs.empty());
+
+    pdrs.emplace_back(std::vector<uint8_t>{1, 2, 3});
+    pdrs.emplace_back(std::vector<uint8_t>{});
+    auto pdr = pdrs.append(2);
+    pdr[0] = 4;
+    pdr[1] = 5;
+    pdrs.emplace_back(std::vector<uint8_t>{6});
+
+    ASSERT_EQ(pdrs.size(), 4);
+    EXPECT_EQ(pdrs.bytes(), 6);
+    EXPECT_TRUE(std::ranges::equal(pdrs[0], std::vector<uint8_t>{1, 2, 3}));
+    EXPECT_TRUE(pdrs[1].empty());
+    EXPECT_TRUE(std::ranges::equal(pdrs[2], std::vector<uint8_t>{4, 5}));
+    EXPECT_TRUE(std::ranges::equal(pdrs.back(), std::vector<uint8_t>{6}));
+
+    size_t count = 0;
+    for (auto pdr : pdrs)
+    {
+        EXPECT_EQ(pdr.data(), pdrs[count++].data());
+    }
+    EXPECT_EQ(count, 4);
+
+    // The kept PDRs are moved down in order
+    auto removed = pdrs.eraseIf(
+        [](std::span<const uint8_t> pdr) { return pdr.size() != 2; });
+    EXPECT_EQ(removed, 3);
+    ASSERT_EQ(pdrs.size(), 1);
+    EXPECT_EQ(pdrs.bytes(), 2);
+    EXPECT_TRUE(std::ranges::equal(pdrs[0], std::vector<uint8_t>{4, 5}));
+
+    pdrs.clear();
+    EXPECT_TRUE(pdrs.empty());
+    EXPECT_EQ(pdrs.begin(), pdrs.end());
+}
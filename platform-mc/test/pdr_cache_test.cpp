@@ -0,0 +1,117 @@
+#include "platform-mc/pdr_cache.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+class PdrCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/pdr_cache_test_XXXXXX";
+        dir = mkdtemp(dirTemplate);
+        signature.updateTime[0] = 1;
+        signature.recordCount = 2;
+        signature.repositorySize = 7;
+        signature.largestRecordSize = 4;
+        pdrs.emplace_back(std::vector<uint8_t>{1, 2, 3});
+        pdrs.emplace_back(std::vector<uint8_t>{4, 5, 6, 7});
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(dir);
+    }
+
+    std::filesystem::path dir;
+    PdrRepositorySignature signature{};
+    const std::string uuid = "f72d6f90-5675-11ed-9b6a-0242ac120002";
+    PdrArena pdrs;
+};
+
+TEST_F(PdrCacheTest, storeAndLoad)
+{
+    PdrCache cache(dir);
+    EXPECT_EQ(cache.load(uuid, signature), std::nullopt);
+
+    cache.store(uuid, signature, pdrs);
+    EXPECT_EQ(cache.load(uuid, signature), pdrs);
+
+    // A changed repository is not loaded
+    auto changed = signature;
+    changed.updateTime[0] = 2;
+    EXPECT_EQ(cache.load(uuid, changed), std::nullopt);
+
+    cache.remove(uuid);
+    EXPECT_EQ(cache.load(uuid, signature), std::nullopt);
+}
+
+TEST_F(PdrCacheTest, unusableKeys)
+{
+    PdrCache cache(dir);
+
+    // Without an update time the signature does not identify the content
+    PdrRepositorySignature noTime{};
+    noTime.recordCount = 2;
+    EXPECT_FALSE(noTime.isValid());
+    cache.store(uuid, noTime, pdrs);
+    EXPECT_EQ(cache.load(uuid, noTime), std::nullopt);
+
+    // A UUID which is not a file name is not cached
+    cache.store("../x", signature, pdrs);
+    EXPECT_EQ(cache.load("../x", signature), std::nullopt);
+    EXPECT_TRUE(std::filesystem::is_empty(dir));
+
+    // A disabled cache stores nothing
+    PdrCache disabled("");
+    disabled.store(uuid, signature, pdrs);
+    EXPECT_EQ(disabled.load(uuid, signature), std::nullopt);
+}
+
+TEST_F(PdrCacheTest, truncatedFile)
+{
+    PdrCache cache(dir);
+    cache.store(uuid, signature, pdrs);
+    std::filesystem::resize_file(dir / uuid,
+                                 std::filesystem::file_size(dir / uuid) - 1);
+    EXPECT_EQ(cache.load(uuid, signature), std::nullopt);
+
+    // The truncated file is removed
+    EXPECT_FALSE(std::filesystem::exists(dir / uuid));
+}
+
+TEST_F(PdrCacheTest, invalidFile)
+{
+    PdrCache cache(dir);
+    std::ofstream(dir / uuid) << "not a PDR cache file";
+    EXPECT_EQ(cache.load(uuid, signature), std::nullopt);
+    EXPECT_FALSE(std::filesystem::exists(dir / uuid));
+}
+
+TEST_F(PdrCacheTest, pruneLeastRecentlyUsed)
+{
+    PdrCache cache(dir, 2);
+    const std::string uuid2 = "f72d6f90-5675-11ed-9b6a-0242ac120003";
+    const std::string uuid3 = "f72d6f90-5675-11ed-9b6a-0242ac120004";
+    auto past = std::filesystem::file_time_type::clock::now() -
+                std::chrono::hours(1);
+
+    cache.store(uuid, signature, pdrs);
+    cache.store(uuid2, signature, pdrs);
+    std::filesystem::last_write_time(dir / uuid, past);
+    std::filesystem::last_write_time(dir / uuid2, past);
+
+    // Loading the first file makes it the most recently used one
+    EXPECT_EQ(cache.load(uuid, signature), pdrs);
+
+    cache.store(uuid3, signature, pdrs);
+    EXPECT_TRUE(std::filesystem::exists(dir / uuid));
+    EXPECT_FALSE(std::filesystem::exists(dir / uuid2));
+    EXPECT_TRUE(std::filesystem::exists(dir / uuid3));
+}
@@ -0,0 +1,79 @@
+#include "platform-mc/polling_budget.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+class TestWaiter : public PollingBudget::Waiter
+{
+  public:
+    TestWaiter(pldm_tid_t tid, std::vector<pldm_tid_t>& granted) :
+        PollingBudget::Waiter(tid), granted(granted)
+    {}
+
+    void grant() override
+    {
+        granted.push_back(tid);
+    }
+
+    std::vector<pldm_tid_t>& granted;
+};
+
+TEST(PollingBudgetTest, boundInFlight)
+{
+    PollingBudget budget(2, 1);
+    std::vector<pldm_tid_t> granted;
+    TestWaiter a1(1, granted);
+    TestWaiter a2(1, granted);
+    TestWaiter b(2, granted);
+    TestWaiter c(3, granted);
+
+    EXPECT_TRUE(budget.acquire(a1, 0));
+    // Only one reading in flight per terminus
+    EXPECT_FALSE(budget.acquire(a2, 0));
+    EXPECT_TRUE(budget.acquire(b, 0));
+    // Only two readings in flight over all the termini
+    EXPECT_FALSE(budget.acquire(c, 0));
+    EXPECT_EQ(budget.getInFlight(), 2);
+    EXPECT_EQ(budget.getInFlight(1), 1);
+
+    // The slot of terminus 2 goes to terminus 3, terminus 1 is still busy
+    budget.release(2);
+    EXPECT_EQ(granted, std::vector<pldm_tid_t>{3});
+    budget.release(1);
+    EXPECT_EQ(granted, (std::vector<pldm_tid_t>{3, 1}));
+    EXPECT_EQ(budget.getInFlight(), 2);
+
+    budget.release(1);
+    budget.release(3);
+    EXPECT_EQ(budget.getInFlight(), 0);
+    EXPECT_EQ(budget.getInFlight(1), 0);
+}
+
+TEST(PollingBudgetTest, networksServedRoundRobin)
+{
+    PollingBudget budget(1, 1);
+    std::vector<pldm_tid_t> granted;
+    TestWaiter a(1, granted);
+    TestWaiter b(2, granted);
+    TestWaiter c(3, granted);
+    TestWaiter d(4, granted);
+    TestWaiter e(5, granted);
+
+    EXPECT_TRUE(budget.acquire(a, 1));
+    // Three termini on network 1 and one on network 2 wait
+    EXPECT_FALSE(budget.acquire(b, 1));
+    EXPECT_FALSE(budget.acquire(c, 1));
+    EXPECT_FALSE(budget.acquire(d, 2));
+    EXPECT_FALSE(budget.acquire(e, 1));
+    budget.cancel(e);
+
+    budget.release(1);
+    budget.release(granted.back());
+    budget.release(granted.back());
+    budget.release(granted.back());
+    EXPECT_EQ(granted, (std::vector<pldm_tid_t>{2, 4, 3}));
+    EXPECT_EQ(budget.getInFlight(), 0);
+}
@@ -0,0 +1,77 @@
+#include "platform-mc/sensor_history.hpp"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+TEST(SensorHistoryTest, aggregateWindows)
+{
+    SensorHistory history(3);
+    EXPECT_EQ(history.add(), 0);
+    EXPECT_EQ(history.add(), 1);
+    EXPECT_EQ(history.size(), 2);
+
+    EXPECT_EQ(SensorHistory::findWindow(60), 1);
+    EXPECT_EQ(SensorHistory::findWindow(30), std::nullopt);
+
+    // Two readings in the same second, then one in the next second
+    history.record(0, 10, 100000000);
+    history.record(0, 20, 100500000);
+    history.record(0, 40, 101000000);
+    history.record(0, std::numeric_limits<double>::quiet_NaN(), 101200000);
+
+    auto seconds = history.getBuckets(0, 0);
+    ASSERT_EQ(seconds.size(), 2);
+    EXPECT_EQ(seconds[0].period, 100);
+    EXPECT_EQ(seconds[0].count, 2);
+    EXPECT_EQ(seconds[0].min, 10);
+    EXPECT_EQ(seconds[0].max, 20);
+    EXPECT_EQ(seconds[0].sum, 30);
+    EXPECT_EQ(seconds[1].period, 101);
+    EXPECT_EQ(seconds[1].count, 1);
+
+    auto minutes = history.getBuckets(0, 1);
+    ASSERT_EQ(minutes.size(), 1);
+    EXPECT_EQ(minutes[0].period, 1);
+    EXPECT_EQ(minutes[0].count, 3);
+    EXPECT_EQ(minutes[0].min, 10);
+    EXPECT_EQ(minutes[0].max, 40);
+    EXPECT_EQ(minutes[0].sum, 70);
+
+    EXPECT_TRUE(history.getBuckets(1, 0).empty());
+
+    // The ring keeps the last windows, oldest first
+    history.record(0, 1, 102000000);
+    history.record(0, 2, 103000000);
+    seconds = history.getBuckets(0, 0);
+    ASSERT_EQ(seconds.size(), 3);
+    EXPECT_EQ(seconds[0].period, 101);
+    EXPECT_EQ(seconds[1].period, 102);
+    EXPECT_EQ(seconds[2].period, 103);
+    EXPECT_EQ(seconds[2].min, 2);
+}
+
+TEST(SensorHistoryTest, disabled)
+{
+    SensorHistory history(0);
+    history.add();
+    history.record(0, 10, 100000000);
+    EXPECT_TRUE(history.getBuckets(0, 0).empty());
+}
+
+TEST(SensorHistoryTest, remove)
+{
+    SensorHistory history(4);
+    history.add();
+    history.add();
+    history.record(1, 10, 100000000);
+
+    // The next sensors move down one index
+    history.remove(0);
+    ASSERT_EQ(history.size(), 1);
+    auto seconds = history.getBuckets(0, 0);
+    ASSERT_EQ(seconds.size(), 1);
+    EXPECT_EQ(seconds[0].min, 10);
+}
@@ -136,8 +136,8 @@ TEST_F(SensorManagerTest, sensorPollingTest)
     uint64_t seconds = 10;
     pldm_tid_t tid = 1;
     termini[tid] = std::make_shared<pldm::platform_mc::Terminus>(tid, 0, event);
-    termini[tid]->pdrs.push_back(pdr1);
-    termini[tid]->pdrs.push_back(pdr2);
+    termini[tid]->pdrs.emplace_back(pdr1);
+    termini[tid]->pdrs.emplace_back(pdr2);
     termini[tid]->parseTerminusPDRs();
 
     uint64_t t0, t1;
@@ -158,3 +158,33 @@ TEST_F(SensorManagerTest, sensorPollingTest)
 
     sensorManager.stopPolling(tid);
 }
+
+TEST_F(SensorManagerTest, updatePdrWithPendingSignalTest)
+{
+    pldm_tid_t tid = 1;
+    termini[tid] = std::make_shared<pldm::platform_mc::Terminus>(tid, 0, event);
+    auto& terminus = termini[tid];
+    terminus->pdrs.emplace_back(pdr1);
+    terminus->pdrs.emplace_back(pdr2);
+    terminus->parseTerminusPDRs();
+    utils::runEventLoopForSeconds(event, 1);
+    ASSERT_EQ(1, terminus->numericSensors.size());
+
+    // A reading completed after the signals of the polling cycle were emitted
+    std::weak_ptr<pldm::platform_mc::NumericSensor> oldSensor =
+        terminus->numericSensors[0];
+    terminus->numericSensors[0]->updateReading(true, true, 10);
+    ASSERT_TRUE(terminus->numericSensors[0]->hasPendingSignals());
+    sensorManager.pendingSignalSensors[tid].emplace_back(
+        terminus->numericSensors[0]);
+
+    // The pending signals are emitted before the PDRs are updated, the
+    // sensor of the changed PDR is then replaced at the same D-Bus path
+    sensorManager.emitSensorSignals(tid);
+    auto changedPdr = pdr1;
+    changedPdr[45] = 3; // hysteresis
+    terminus->updateTerminusPDRs({}, {changedPdr});
+
+    EXPECT_TRUE(oldSensor.expired());
+    EXPECT_EQ(1, terminus->numericSensors.size());
+}
@@ -0,0 +1,56 @@
+#include "platform-mc/sensor_scheduler.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+TEST(SensorSchedulerTest, popDueSensors)
+{
+    SensorScheduler scheduler;
+    std::vector<uint64_t> dueTimes{300, 0, 100, 200, 100};
+    scheduler.reset(dueTimes.size(),
+                    [&dueTimes](size_t index) { return dueTimes[index]; });
+    EXPECT_EQ(scheduler.size(), 5);
+    EXPECT_EQ(scheduler.nextDueTime(), 0);
+
+    // Only the sensors due are returned, the earliest first
+    EXPECT_EQ(scheduler.popDue(150), 1);
+    EXPECT_EQ(scheduler.popDue(150), 2);
+    EXPECT_EQ(scheduler.popDue(150), 4);
+    EXPECT_EQ(scheduler.popDue(150), std::nullopt);
+    EXPECT_EQ(scheduler.size(), 2);
+
+    // A sensor scheduled again is ordered by its new due time
+    scheduler.schedule(1, 250);
+    EXPECT_EQ(scheduler.nextDueTime(), 200);
+    EXPECT_EQ(scheduler.popDue(1000), 3);
+    EXPECT_EQ(scheduler.popDue(1000), 1);
+    EXPECT_EQ(scheduler.popDue(1000), 0);
+    EXPECT_EQ(scheduler.popDue(1000), std::nullopt);
+    EXPECT_EQ(scheduler.nextDueTime(), std::nullopt);
+    EXPECT_EQ(scheduler.size(), 0);
+}
+
+TEST(SensorSchedulerTest, manySlowSensors)
+{
+    SensorScheduler scheduler;
+    // One fast sensor polled every 100us among 500 sensors due every second
+    scheduler.reset(501, [](size_t index) -> uint64_t {
+        return index ? 1000000 : 0;
+    });
+
+    size_t numPolled = 0;
+    for (uint64_t now = 0; now < 1000000; now += 100)
+    {
+        while (auto index = scheduler.popDue(now))
+        {
+            EXPECT_EQ(*index, 0);
+            scheduler.schedule(*index, now + 100);
+            numPolled++;
+        }
+    }
+    EXPECT_EQ(numPolled, 10000);
+    EXPECT_EQ(scheduler.size(), 501);
+}
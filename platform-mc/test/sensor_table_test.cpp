@@ -0,0 +1,133 @@
+#include "platform-mc/sensor_table.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+TEST(SensorTableTest, recordReadings)
+{
+    SensorTable table;
+    SensorConversion conversion{};
+    conversion.scale = 15;
+    conversion.bias = 10;
+    EXPECT_EQ(table.add(3, 1000000, conversion), 0);
+    EXPECT_EQ(table.add(7, 500000, SensorConversion{}), 1);
+    EXPECT_EQ(table.size(), 2);
+
+    EXPECT_EQ(table.find(7), 1);
+    EXPECT_EQ(table.find(4), std::nullopt);
+
+    // A sensor never read is due immediately
+    EXPECT_EQ(table.getDueTime(0), 0);
+
+    table.recordReading(0, 40, 2000);
+    EXPECT_EQ(table.getDueTime(0), 1002000);
+    EXPECT_EQ(table.statuses[0], SensorTable::readingValid);
+
+    table.recordReading(1, std::numeric_limits<double>::quiet_NaN(), 3000);
+    EXPECT_EQ(table.getDueTime(1), 503000);
+    EXPECT_EQ(table.statuses[1], 0);
+    table.recordFailure(1);
+    EXPECT_EQ(table.statuses[1], SensorTable::readFailed);
+
+    std::vector<double> values(table.size());
+    table.convert(values);
+    EXPECT_EQ(values[0], 610);
+    EXPECT_TRUE(std::isnan(values[1]));
+}
+
+TEST(SensorTableTest, eventHeartbeat)
+{
+    SensorTable table;
+    table.heartbeatTime = 10000000;
+    table.add(3, 1000000, SensorConversion{});
+
+    // Without events the update interval applies
+    table.recordReading(0, 40, 2000);
+    EXPECT_FALSE(table.isEventDriven(0));
+    EXPECT_EQ(table.getDueTime(0), 1002000);
+
+    // An event delays the next reading to the heartbeat interval
+    table.recordEvent(0, 41, 500000);
+    EXPECT_TRUE(table.isEventDriven(0));
+    EXPECT_EQ(table.getDueTime(0), 10002000);
+    EXPECT_EQ(table.rawValues[0], 41);
+
+    // A heartbeat reading shortly after the event keeps the slow rate
+    table.recordReading(0, 42, 9000000);
+    EXPECT_TRUE(table.isEventDriven(0));
+    EXPECT_EQ(table.getDueTime(0), 19000000);
+
+    // No event for a heartbeat interval goes back to the update interval
+    table.recordReading(0, 43, 19000000);
+    EXPECT_FALSE(table.isEventDriven(0));
+    EXPECT_EQ(table.getDueTime(0), 20000000);
+
+    // Disabled heartbeat ignores the events
+    table.heartbeatTime = 0;
+    table.recordEvent(0, 44, 19500000);
+    EXPECT_FALSE(table.isEventDriven(0));
+    EXPECT_EQ(table.getDueTime(0), 20000000);
+}
+
+TEST(SensorTableTest, adaptivePolling)
+{
+    SensorTable table;
+    table.adaptiveCycles = 2;
+    table.maxPollInterval = 3000000;
+    table.add(3, 1000000, SensorConversion{});
+    table.recordReading(0, 40, 2000);
+    EXPECT_TRUE(std::isnan(table.steadyRawValues[0]));
+
+    // The first reading starts a steady run
+    table.adaptPollInterval(0, false, 40);
+    EXPECT_EQ(table.steadyRawValues[0], 40);
+
+    // The interval doubles after two steady readings, up to the maximum
+    table.adaptPollInterval(0, true, 41);
+    EXPECT_EQ(table.getDueTime(0), 1002000);
+    table.adaptPollInterval(0, true, 42);
+    EXPECT_EQ(table.getDueTime(0), 2002000);
+    table.adaptPollInterval(0, true, 41);
+    table.adaptPollInterval(0, true, 42);
+    EXPECT_EQ(table.getDueTime(0), 3002000);
+
+    // The steady run keeps the reading which started it
+    EXPECT_EQ(table.steadyRawValues[0], 40);
+
+    // A change goes back to the update interval and starts a new run
+    table.adaptPollInterval(0, false, 45);
+    EXPECT_EQ(table.getDueTime(0), 1002000);
+    EXPECT_EQ(table.steadyRawValues[0], 45);
+
+    // A failed reading ends the run
+    table.adaptPollInterval(0, false,
+                            std::numeric_limits<double>::quiet_NaN());
+    EXPECT_TRUE(std::isnan(table.steadyRawValues[0]));
+
+    // Disabled adaptive polling keeps the update interval
+    table.adaptiveCycles = 0;
+    table.adaptPollInterval(0, true, 45);
+    table.adaptPollInterval(0, true, 45);
+    EXPECT_EQ(table.getDueTime(0), 1002000);
+}
+
+TEST(SensorTableTest, remove)
+{
+    SensorTable table;
+    table.add(1, 1000000, SensorConversion{});
+    table.add(2, 2000000, SensorConversion{});
+    table.add(3, 3000000, SensorConversion{});
+    table.recordReading(2, 42, 1000);
+
+    // The next sensors move down one index
+    table.remove(1);
+    ASSERT_EQ(table.size(), 2);
+    EXPECT_FALSE(table.find(2));
+    EXPECT_EQ(table.find(3), 1);
+    EXPECT_EQ(table.rawValues[1], 42);
+    EXPECT_EQ(table.getDueTime(1), 3001000);
+}
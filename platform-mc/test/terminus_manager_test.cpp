@@ -245,6 +245,79 @@ TEST_F(TerminusManagerTest, negativeDiscoverMctpTerminusTest)
     EXPECT_EQ(0, termini.size());
 }
 
+TEST_F(TerminusManagerTest, discoverMctpTerminusSameTidTest)
+{
+    const size_t getTidRespLen = PLDM_GET_TID_RESP_BYTES;
+    const size_t setTidRespLen = PLDM_SET_TID_RESP_BYTES;
+    const size_t getPldmTypesRespLen = PLDM_GET_TYPES_RESP_BYTES;
+
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getTidRespLen> getTidResp0{
+        0x00, 0x02, 0x02, 0x00, PLDM_TID_RESERVED};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getTidRespLen> getTidResp1{
+        0x00, 0x02, 0x02, 0x00, 0x01};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + setTidRespLen> setTidResp{
+        0x00, 0x02, 0x01, 0x00};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getPldmTypesRespLen>
+        getPldmTypesResp{0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+                         0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+    // the first endpoint fails, the other two report the same TID
+    auto rc = mockTerminusManager.enqueueResponse(
+        new (getTidResp0.data()) pldm_msg, sizeof(getTidResp0));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    rc = mockTerminusManager.enqueueResponse(new (getTidResp1.data()) pldm_msg,
+                                             sizeof(getTidResp1));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    rc = mockTerminusManager.enqueueResponse(
+        new (getPldmTypesResp.data()) pldm_msg, sizeof(getPldmTypesResp));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    rc = mockTerminusManager.enqueueResponse(new (getTidResp1.data()) pldm_msg,
+                                             sizeof(getTidResp1));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    rc = mockTerminusManager.enqueueResponse(new (setTidResp.data()) pldm_msg,
+                                             sizeof(setTidResp));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    rc = mockTerminusManager.enqueueResponse(
+        new (getPldmTypesResp.data()) pldm_msg, sizeof(getPldmTypesResp));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    pldm::MctpInfos mctpInfos{};
+    mctpInfos.emplace_back(pldm::MctpInfo(11, "", "", 1));
+    mctpInfos.emplace_back(pldm::MctpInfo(12, "", "", 1));
+    mctpInfos.emplace_back(pldm::MctpInfo(13, "", "", 1));
+    mockTerminusManager.discoverMctpTerminus(mctpInfos);
+
+    // the second endpoint keeps its TID, the third one gets another TID
+    EXPECT_EQ(2, termini.size());
+    EXPECT_EQ(std::nullopt, mockTerminusManager.toTid(mctpInfos[0]));
+    EXPECT_EQ(1, mockTerminusManager.toTid(mctpInfos[1]));
+    auto tid = mockTerminusManager.toTid(mctpInfos[2]);
+    ASSERT_NE(std::nullopt, tid);
+    EXPECT_NE(1, tid.value());
+    EXPECT_TRUE(termini.contains(tid.value()));
+
+    // the failed endpoint did not stop the discovery of the next list
+    rc = mockTerminusManager.enqueueResponse(new (getTidResp1.data()) pldm_msg,
+                                             sizeof(getTidResp1));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    rc = mockTerminusManager.enqueueResponse(new (setTidResp.data()) pldm_msg,
+                                             sizeof(setTidResp));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    rc = mockTerminusManager.enqueueResponse(
+        new (getPldmTypesResp.data()) pldm_msg, sizeof(getPldmTypesResp));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    pldm::MctpInfos nextMctpInfos{};
+    nextMctpInfos.emplace_back(pldm::MctpInfo(14, "", "", 1));
+    mockTerminusManager.discoverMctpTerminus(nextMctpInfos);
+    EXPECT_EQ(3, termini.size());
+    EXPECT_NE(std::nullopt, mockTerminusManager.toTid(nextMctpInfos[0]));
+
+    mockTerminusManager.removeMctpTerminus(mctpInfos);
+    mockTerminusManager.removeMctpTerminus(nextMctpInfos);
+    EXPECT_EQ(0, termini.size());
+}
+
 TEST_F(TerminusManagerTest, doesSupportTypeTest)
 {
     const size_t getTidRespLen = PLDM_GET_TID_RESP_BYTES;
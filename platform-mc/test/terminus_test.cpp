@@ -3,6 +3,8 @@
 
 #include <libpldm/entity.h>
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 TEST(TerminusTest, supportedTypeTest)
@@ -388,3 +390,195 @@ TEST(TerminusTest, parsePDRTestNoSensorPDR)
     auto sensorAuxNames = t1.getSensorAuxiliaryNames(1);
     EXPECT_EQ(nullptr, sensorAuxNames);
 }
+
+TEST(TerminusTest, updateTerminusPDRsTest)
+{
+    auto event = sdeventplus::Event::get_default();
+    auto t1 = pldm::platform_mc::Terminus(
+        1, 1 << PLDM_BASE | 1 << PLDM_PLATFORM, event);
+    std::vector<uint8_t> pdr1{
+        0x2,
+        0x0,
+        0x0,
+        0x0,                             // record handle
+        0x1,                             // PDRHeaderVersion
+        PLDM_SENSOR_AUXILIARY_NAMES_PDR, // PDRType
+        0x0,
+        0x0,                             // recordChangeNumber
+        0x0,
+        21,                              // dataLength
+        0,
+        0x0,                             // PLDMTerminusHandle
+        0x1,
+        0x0,                             // sensorID
+        0x1,                             // sensorCount
+        0x1,                             // nameStringCount
+        'e',
+        'n',
+        0x0, // nameLanguageTag
+        0x0,
+        'T',
+        0x0,
+        'E',
+        0x0,
+        'M',
+        0x0,
+        'P',
+        0x0,
+        '1',
+        0x0,
+        0x0 // sensorName
+    };
+
+    std::vector<uint8_t> pdr2{
+        0x1, 0x0, 0x0,
+        0x0,                             // record handle
+        0x1,                             // PDRHeaderVersion
+        PLDM_ENTITY_AUXILIARY_NAMES_PDR, // PDRType
+        0x1,
+        0x0,                             // recordChangeNumber
+        0x11,
+        0,                               // dataLength
+        /* Entity Auxiliary Names PDR Data*/
+        3,
+        0x80, // entityType system software
+        0x1,
+        0x0,  // Entity instance number =1
+        0,
+        0,    // Overall system
+        0,    // shared Name Count one name only
+        01,   // nameStringCount
+        0x65, 0x6e, 0x00,
+        0x00, // Language Tag "en"
+        0x53, 0x00, 0x30, 0x00,
+        0x00  // Entity Name "S0"
+    };
+
+    t1.pdrs.emplace_back(pdr1);
+    t1.pdrs.emplace_back(pdr2);
+    t1.parseTerminusPDRs();
+
+    // Modify the sensor name, the PDR keeps its record handle
+    auto modifiedPdr = pdr1;
+    modifiedPdr[28] = '2';
+    std::vector<std::vector<uint8_t>> changedPdrs{modifiedPdr};
+    t1.updateTerminusPDRs({}, std::move(changedPdrs));
+
+    EXPECT_EQ(2, t1.pdrs.size());
+    auto sensorAuxNames = t1.getSensorAuxiliaryNames(1);
+    ASSERT_NE(nullptr, sensorAuxNames);
+    const auto& [sensorId, sensorCnt, names] = *sensorAuxNames;
+    EXPECT_EQ(1, sensorId);
+    EXPECT_EQ("TEMP2", names[0][0].second);
+    EXPECT_EQ("S0", t1.getTerminusName().value());
+
+    // Delete the sensor names
+    t1.updateTerminusPDRs({2}, {});
+
+    EXPECT_EQ(1, t1.pdrs.size());
+    EXPECT_EQ(nullptr, t1.getSensorAuxiliaryNames(1));
+    EXPECT_EQ("S0", t1.getTerminusName().value());
+}
+
+TEST(TerminusTest, addTerminusPDRTest)
+{
+    auto event = sdeventplus::Event::get_default();
+    auto t1 = pldm::platform_mc::Terminus(
+        1, 1 << PLDM_BASE | 1 << PLDM_PLATFORM, event);
+    std::vector<uint8_t> pdr1{
+        0x2,
+        0x0,
+        0x0,
+        0x0,                             // record handle
+        0x1,                             // PDRHeaderVersion
+        PLDM_SENSOR_AUXILIARY_NAMES_PDR, // PDRType
+        0x0,
+        0x0,                             // recordChangeNumber
+        0x0,
+        21,                              // dataLength
+        0,
+        0x0,                             // PLDMTerminusHandle
+        0x1,
+        0x0,                             // sensorID
+        0x1,                             // sensorCount
+        0x1,                             // nameStringCount
+        'e',
+        'n',
+        0x0, // nameLanguageTag
+        0x0,
+        'T',
+        0x0,
+        'E',
+        0x0,
+        'M',
+        0x0,
+        'P',
+        0x0,
+        '1',
+        0x0,
+        0x0 // sensorName
+    };
+
+    std::vector<uint8_t> pdr2{
+        0x1, 0x0, 0x0,
+        0x0,                             // record handle
+        0x1,                             // PDRHeaderVersion
+        PLDM_ENTITY_AUXILIARY_NAMES_PDR, // PDRType
+        0x1,
+        0x0,                             // recordChangeNumber
+        0x11,
+        0,                               // dataLength
+        /* Entity Auxiliary Names PDR Data*/
+        3,
+        0x80, // entityType system software
+        0x1,
+        0x0,  // Entity instance number =1
+        0,
+        0,    // Overall system
+        0,    // shared Name Count one name only
+        01,   // nameStringCount
+        0x65, 0x6e, 0x00,
+        0x00, // Language Tag "en"
+        0x53, 0x00, 0x30, 0x00,
+        0x00  // Entity Name "S0"
+    };
+
+    // Each PDR is parsed when it is added
+    t1.addTerminusPDR(pdr1);
+    EXPECT_EQ(1, t1.pdrs.size());
+    EXPECT_NE(nullptr, t1.getSensorAuxiliaryNames(1));
+    EXPECT_FALSE(t1.getTerminusName().has_value());
+
+    t1.addTerminusPDR(pdr2);
+    EXPECT_EQ(2, t1.pdrs.size());
+    EXPECT_EQ("S0", t1.getTerminusName().value());
+    EXPECT_TRUE(std::ranges::equal(pdr2, t1.pdrs.back()));
+
+    t1.completeTerminusPDRs();
+    EXPECT_EQ("S0", t1.getTerminusName().value());
+
+    t1.resetTerminusPDRs();
+    EXPECT_EQ(0, t1.pdrs.size());
+    EXPECT_EQ(nullptr, t1.getSensorAuxiliaryNames(1));
+}
+
+TEST(TerminusTest, mergeOlderPdrChangesTest)
+{
+    pldm::platform_mc::PdrChanges older;
+    older.deletedHandles = {1, 2};
+    older.changedHandles = {3, 4};
+
+    // changes signaled while the older ones were fetched
+    pldm::platform_mc::PdrChanges changes;
+    changes.changedHandles = {1};
+    changes.deletedHandles = {3};
+
+    changes.mergeOlder(older);
+    EXPECT_FALSE(changes.refreshAll);
+    EXPECT_EQ(changes.deletedHandles, (std::set<uint32_t>{2, 3}));
+    EXPECT_EQ(changes.changedHandles, (std::set<uint32_t>{1, 4}));
+
+    older.refreshAll = true;
+    changes.mergeOlder(older);
+    EXPECT_TRUE(changes.refreshAll);
+}
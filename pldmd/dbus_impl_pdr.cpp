@@ -1,6 +1,5 @@
 #include "dbus_impl_pdr.hpp"
 
-#include "common/utils.hpp"
 #include "xyz/openbmc_project/Common/error.hpp"
 
 #include <libpldm/pdr.h>
@@ -13,11 +12,29 @@ namespace pldm
 namespace dbus_api
 {
 
+/** @brief Copy the data of PDR records
+ *
+ *  @param[in] records - the PDR records
+ *
+ *  @return the PDRs
+ */
+static std::vector<std::vector<uint8_t>> copyRecords(
+    const std::vector<pldm::responder::pdr_utils::IndexedRecord>& records)
+{
+    std::vector<std::vector<uint8_t>> pdrs;
+    pdrs.reserve(records.size());
+    for (const auto& record : records)
+    {
+        pdrs.emplace_back(record.data, record.data + record.size);
+    }
+    return pdrs;
+}
+
 std::vector<std::vector<uint8_t>> Pdr::findStateEffecterPDR(
-    uint8_t tid, uint16_t entityID, uint16_t stateSetId)
+    uint8_t /*tid*/, uint16_t entityID, uint16_t stateSetId)
 {
     auto pdrs =
-        pldm::utils::findStateEffecterPDR(tid, entityID, stateSetId, pdrRepo);
+        copyRecords(pdrRepo.findStateEffecterRecords(entityID, stateSetId));
 
     if (pdrs.empty())
     {
@@ -28,10 +45,10 @@ std::vector<std::vector<uint8_t>> Pdr::findStateEffecterPDR(
 }
 
 std::vector<std::vector<uint8_t>> Pdr::findStateSensorPDR(
-    uint8_t tid, uint16_t entityID, uint16_t stateSetId)
+    uint8_t /*tid*/, uint16_t entityID, uint16_t stateSetId)
 {
     auto pdrs =
-        pldm::utils::findStateSensorPDR(tid, entityID, stateSetId, pdrRepo);
+        copyRecords(pdrRepo.findStateSensorRecords(entityID, stateSetId));
     if (pdrs.empty())
     {
         throw ResourceNotFound();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "libpldmresponder/pdr_utils.hpp"
 #include "xyz/openbmc_project/PLDM/PDR/server.hpp"
 
 #include <libpldm/pdr.h>
@@ -38,7 +39,7 @@ class Pdr : public PdrIntf
      *  @param[in] path - Path to attach at.
      *  @param[in] repo - pointer to BMC's primary PDR repo
      */
-    Pdr(sdbusplus::bus_t& bus, const std::string& path, const pldm_pdr* repo) :
+    Pdr(sdbusplus::bus_t& bus, const std::string& path, pldm_pdr* repo) :
         PdrIntf(bus, path.c_str()), pdrRepo(repo) {};
 
     /** @brief Implementation for PdrIntf.FindStateEffecterPDR
@@ -58,8 +59,8 @@ class Pdr : public PdrIntf
         uint8_t tid, uint16_t entityID, uint16_t stateSetId) override;
 
   private:
-    /** @brief pointer to BMC's primary PDR repo */
-    const pldm_pdr* pdrRepo;
+    /** @brief BMC's primary PDR repo indexed for lookups */
+    pldm::responder::pdr_utils::Repo pdrRepo;
 };
 
 } // namespace dbus_api
@@ -0,0 +1,27 @@
+#include "dbus_impl_requester_metrics.hpp"
+
+namespace pldm
+{
+namespace dbus_api
+{
+
+std::vector<requester::CommandMetricsRecord>
+    RequesterMetrics::getCommandMetrics()
+{
+    return handler.getMetrics().getRecords();
+}
+
+std::vector<requester::EndpointMetricsRecord>
+    RequesterMetrics::getEndpointMetrics()
+{
+    return handler.getEndpointMetrics();
+}
+
+void RequesterMetrics::reset()
+{
+    handler.getMetrics().reset();
+    instanceIdDb.resetExhaustedCounts();
+}
+
+} // namespace dbus_api
+} // namespace pldm
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "pldm/RequesterMetrics/server.hpp"
+#include "requester/handler.hpp"
+#include "requester/request.hpp"
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/object.hpp>
+
+#include <string>
+#include <vector>
+
+namespace pldm
+{
+namespace dbus_api
+{
+
+using RequesterMetricsIntf =
+    sdbusplus::server::object_t<sdbusplus::pldm::server::RequesterMetrics>;
+
+/** @class RequesterMetrics
+ *  @brief OpenBMC PLDM.RequesterMetrics Implementation
+ *  @details A concrete implementation for the
+ *  pldm.RequesterMetrics DBus APIs, defined in
+ *  yaml/pldm/RequesterMetrics.interface.yaml, exposing the metrics of the
+ *  PLDM requests sent by the requester handler.
+ */
+class RequesterMetrics : public RequesterMetricsIntf
+{
+  public:
+    RequesterMetrics() = delete;
+    RequesterMetrics(const RequesterMetrics&) = delete;
+    RequesterMetrics& operator=(const RequesterMetrics&) = delete;
+    RequesterMetrics(RequesterMetrics&&) = delete;
+    RequesterMetrics& operator=(RequesterMetrics&&) = delete;
+    virtual ~RequesterMetrics() = default;
+
+    /** @brief Constructor to put object onto bus at a dbus path.
+     *  @param[in] bus - Bus to attach to.
+     *  @param[in] path - Path to attach at.
+     *  @param[in] handler - PLDM request handler
+     *  @param[in] instanceIdDb - PLDM instance ID database
+     */
+    RequesterMetrics(sdbusplus::bus_t& bus, const std::string& path,
+                     requester::Handler<requester::Request>& handler,
+                     InstanceIdDb& instanceIdDb) :
+        RequesterMetricsIntf(bus, path.c_str()), handler(handler),
+        instanceIdDb(instanceIdDb)
+    {}
+
+    /** @brief Implementation for RequesterMetricsIntf.GetCommandMetrics
+     *
+     *  @return the metrics of each command, see
+     *          requester::CommandMetricsRecord
+     */
+    std::vector<requester::CommandMetricsRecord> getCommandMetrics() override;
+
+    /** @brief Implementation for RequesterMetricsIntf.GetEndpointMetrics
+     *
+     *  @return the metrics of each endpoint, see
+     *          requester::EndpointMetricsRecord
+     */
+    std::vector<requester::EndpointMetricsRecord> getEndpointMetrics()
+        override;
+
+    /** @brief Implementation for RequesterMetricsIntf.Reset */
+    void reset() override;
+
+  private:
+    /** @brief PLDM request handler */
+    requester::Handler<requester::Request>& handler;
+
+    /** @brief PLDM instance ID database */
+    InstanceIdDb& instanceIdDb;
+};
+
+} // namespace dbus_api
+} // namespace pldm
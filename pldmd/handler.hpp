@@ -2,9 +2,11 @@
 
 #include <libpldm/base.h>
 
+#include <array>
 #include <cassert>
 #include <functional>
-#include <map>
+#include <limits>
+#include <optional>
 #include <vector>
 
 namespace pldm
@@ -20,6 +22,58 @@ class CmdHandler;
 using HandlerFunc = std::function<Response(
     pldm_tid_t tid, const pldm_msg* request, size_t reqMsgLen)>;
 
+/** @brief Number of PLDM command codes */
+constexpr size_t numCommands = std::numeric_limits<Command>::max() + 1;
+
+/** @class CommandTable
+ *
+ *  Flat table of the handlers of a PLDM type indexed by the command code.
+ */
+class CommandTable
+{
+  public:
+    /** @brief Add the handler of a command, the handler already registered
+     *         for the command is kept
+     *
+     *  @param[in] command - PLDM command code
+     *  @param[in] handler - handler of the command
+     *  @return true if the handler was added
+     */
+    bool emplace(Command command, HandlerFunc handler)
+    {
+        if (table[command])
+        {
+            return false;
+        }
+        table[command] = std::move(handler);
+        return true;
+    }
+
+    /** @brief Find the handler of a command
+     *
+     *  @param[in] command - PLDM command code
+     *  @return the handler, nullptr if the command is not supported
+     */
+    const HandlerFunc* find(Command command) const
+    {
+        const auto& handler = table[command];
+        return handler ? &handler : nullptr;
+    }
+
+    /** @brief Check if a command is supported
+     *
+     *  @param[in] command - PLDM command code
+     *  @return true if a handler is registered for the command
+     */
+    bool contains(Command command) const
+    {
+        return static_cast<bool>(table[command]);
+    }
+
+  private:
+    std::array<HandlerFunc, numCommands> table;
+};
+
 class CmdHandler
 {
   public:
@@ -31,12 +85,18 @@ class CmdHandler
      *  @param[in] pldmCommand - PLDM command code
      *  @param[in] request - PLDM request message
      *  @param[in] reqMsgLen - PLDM request message size
-     *  @return PLDM response message
+     *  @return PLDM response message, std::nullopt if the command is not
+     *          supported
      */
-    Response handle(pldm_tid_t tid, Command pldmCommand,
-                    const pldm_msg* request, size_t reqMsgLen)
+    std::optional<Response> handle(pldm_tid_t tid, Command pldmCommand,
+                                   const pldm_msg* request, size_t reqMsgLen)
     {
-        return handlers.at(pldmCommand)(tid, request, reqMsgLen);
+        auto handler = handlers.find(pldmCommand);
+        if (!handler)
+        {
+            return std::nullopt;
+        }
+        return (*handler)(tid, request, reqMsgLen);
     }
 
     /** @brief Create a response message containing only cc
@@ -57,10 +117,10 @@ class CmdHandler
     }
 
   protected:
-    /** @brief map of PLDM command code to handler - to be populated by derived
-     *         classes.
+    /** @brief table of PLDM command code to handler - to be populated by
+     *         derived classes.
      */
-    std::map<Command, HandlerFunc> handlers;
+    CommandTable handlers;
 };
 
 } // namespace responder
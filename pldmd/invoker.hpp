@@ -4,8 +4,9 @@
 
 #include <libpldm/base.h>
 
-#include <map>
+#include <array>
 #include <memory>
+#include <optional>
 
 namespace pldm
 {
@@ -15,17 +16,27 @@ using Type = uint8_t;
 namespace responder
 {
 
+/** @brief Number of PLDM types, the PLDM type is a 6-bit field of the PLDM
+ *         message header
+ */
+constexpr size_t numTypes = 64;
+
 class Invoker
 {
   public:
     /** @brief Register a handler for a PLDM Type
+     *
+     *  The handler already registered for the PLDM type is kept.
      *
      *  @param[in] pldmType - PLDM type code
      *  @param[in] handler - PLDM Type handler
      */
     void registerHandler(Type pldmType, std::unique_ptr<CmdHandler> handler)
     {
-        handlers.emplace(pldmType, std::move(handler));
+        if (pldmType < numTypes && !handlers[pldmType])
+        {
+            handlers[pldmType] = std::move(handler);
+        }
     }
 
     /** @brief Invoke a PLDM command handler
@@ -35,17 +46,24 @@ class Invoker
      *  @param[in] pldmCommand - PLDM command code
      *  @param[in] request - PLDM request message
      *  @param[in] reqMsgLen - PLDM request message size
-     *  @return PLDM response message
+     *  @return PLDM response message, std::nullopt if the PLDM type or command
+     *          is not supported
      */
-    Response handle(pldm_tid_t tid, Type pldmType, Command pldmCommand,
-                    const pldm_msg* request, size_t reqMsgLen)
+    std::optional<Response> handle(pldm_tid_t tid, Type pldmType,
+                                   Command pldmCommand, const pldm_msg* request,
+                                   size_t reqMsgLen)
     {
-        return handlers.at(pldmType)->handle(tid, pldmCommand, request,
-                                             reqMsgLen);
+        if (pldmType >= numTypes || !handlers[pldmType])
+        {
+            return std::nullopt;
+        }
+        return handlers[pldmType]->handle(tid, pldmCommand, request,
+                                          reqMsgLen);
     }
 
   private:
-    std::map<Type, std::unique_ptr<CmdHandler>> handlers;
+    /** @brief PLDM type handlers indexed by the PLDM type code */
+    std::array<std::unique_ptr<CmdHandler>, numTypes> handlers;
 };
 
 } // namespace responder
@@ -38,7 +38,9 @@
 #include <iomanip>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -68,6 +70,14 @@ PHOSPHOR_LOG2_USING;
 #include "oem/ampere/oem_ampere.hpp"
 #endif
 
+#ifdef REQUESTER_METRICS
+#include "dbus_impl_requester_metrics.hpp"
+#endif
+
+#ifdef SENSOR_READINGS
+#include "platform-mc/dbus_impl_sensor_readings.hpp"
+#endif
+
 constexpr const char* PLDMService = "xyz.openbmc_project.PLDM";
 
 using namespace pldm;
@@ -100,69 +110,109 @@ void requestPLDMServiceName()
     }
 }
 
-static std::optional<Response> processRxMsg(
-    const std::vector<uint8_t>& requestMsg, Invoker& invoker,
-    requester::Handler<requester::Request>& handler,
-    fw_update::Manager* fwManager, pldm_tid_t tid)
+/** @brief Encode the response to a request for an unsupported PLDM type or
+ *         command
+ *
+ *  @param[in] hdrFields - the header fields of the request
+ *  @param[out] response - the response message
+ *
+ *  @return true on success
+ */
+static bool encodeUnsupportedCmdResponse(const pldm_header_info& hdrFields,
+                                         Response& response)
+{
+    response.assign(sizeof(pldm_msg_hdr), 0);
+    auto responseHdr = new (response.data()) pldm_msg_hdr;
+    pldm_header_info header{};
+    header.msg_type = PLDM_RESPONSE;
+    header.instance = hdrFields.instance;
+    header.pldm_type = hdrFields.pldm_type;
+    header.command = hdrFields.command;
+    if (PLDM_SUCCESS != pack_pldm_header(&header, responseHdr))
+    {
+        return false;
+    }
+    response.push_back(PLDM_ERROR_UNSUPPORTED_PLDM_CMD);
+    return true;
+}
+
+/** @brief Process a PLDM message received from the transport
+ *
+ *  @param[in] requestMsg - the received message, a view of the transport
+ *                          buffer
+ *  @param[in] invoker - the PLDM responder command handlers
+ *  @param[in] handler - the PLDM request handler
+ *  @param[in] fwManager - the firmware update manager
+ *  @param[in] tid - the TID of the remote endpoint
+ *  @param[out] response - the response message, the buffer is reused across
+ *                         the received messages
+ *
+ *  @return true if a response has to be sent
+ */
+static bool processRxMsg(std::span<const uint8_t> requestMsg, Invoker& invoker,
+                         requester::Handler<requester::Request>& handler,
+                         fw_update::Manager* fwManager, pldm_tid_t tid,
+                         Response& response)
 {
     uint8_t eid = tid;
 
     pldm_header_info hdrFields{};
     auto hdr = reinterpret_cast<const pldm_msg_hdr*>(requestMsg.data());
-    if (PLDM_SUCCESS != unpack_pldm_header(hdr, &hdrFields))
+    if (requestMsg.size() < sizeof(struct pldm_msg_hdr) ||
+        PLDM_SUCCESS != unpack_pldm_header(hdr, &hdrFields))
     {
         error("Empty PLDM request header");
-        return std::nullopt;
+        return false;
     }
 
     if (PLDM_RESPONSE != hdrFields.msg_type)
     {
-        Response response;
         auto request = reinterpret_cast<const pldm_msg*>(hdr);
         size_t requestLen = requestMsg.size() - sizeof(struct pldm_msg_hdr);
+        std::optional<Response> handlerResponse;
         try
         {
             if (hdrFields.pldm_type != PLDM_FWUP)
             {
-                response =
+                handlerResponse =
                     invoker.handle(tid, hdrFields.pldm_type, hdrFields.command,
                                    request, requestLen);
             }
             else
             {
-                response = fwManager->handleRequest(eid, hdrFields.command,
-                                                    request, requestLen);
+                handlerResponse = fwManager->handleRequest(
+                    eid, hdrFields.command, request, requestLen);
             }
         }
         catch (const std::out_of_range& e)
         {
-            uint8_t completion_code = PLDM_ERROR_UNSUPPORTED_PLDM_CMD;
-            response.resize(sizeof(pldm_msg_hdr));
-            auto responseHdr = new (response.data()) pldm_msg_hdr;
-            pldm_header_info header{};
-            header.msg_type = PLDM_RESPONSE;
-            header.instance = hdrFields.instance;
-            header.pldm_type = hdrFields.pldm_type;
-            header.command = hdrFields.command;
-            if (PLDM_SUCCESS != pack_pldm_header(&header, responseHdr))
-            {
-                error(
-                    "Failed to add response header for processing Rx, error - {ERROR}",
-                    "ERROR", e);
-                return std::nullopt;
-            }
-            response.insert(response.end(), completion_code);
+            error(
+                "Failed to handle PLDM type '{TYPE}' command '{COMMAND}', error - {ERROR}",
+                "TYPE", hdrFields.pldm_type, "COMMAND", hdrFields.command,
+                "ERROR", e);
+        }
+
+        if (handlerResponse)
+        {
+            response = std::move(*handlerResponse);
+        }
+        else if (!encodeUnsupportedCmdResponse(hdrFields, response))
+        {
+            error(
+                "Failed to add response header for processing Rx of PLDM type '{TYPE}' command '{COMMAND}'",
+                "TYPE", hdrFields.pldm_type, "COMMAND", hdrFields.command);
+            return false;
         }
-        return response;
+        return true;
     }
     else if (PLDM_RESPONSE == hdrFields.msg_type)
     {
-        auto response = reinterpret_cast<const pldm_msg*>(hdr);
+        auto responseMsg = reinterpret_cast<const pldm_msg*>(hdr);
         size_t responseLen = requestMsg.size() - sizeof(struct pldm_msg_hdr);
         handler.handleResponse(eid, hdrFields.instance, hdrFields.pldm_type,
-                               hdrFields.command, response, responseLen);
+                               hdrFields.command, responseMsg, responseLen);
     }
-    return std::nullopt;
+    return false;
 }
 
 void optionUsage(void)
@@ -192,9 +242,6 @@ int main(int argc, char** argv)
     }
     // Setup PLDM requester transport
     auto hostEID = pldm::utils::readHostEID();
-    /* To maintain current behaviour until we have the infrastructure to find
-     * and use the correct TIDs */
-    pldm_tid_t TID = hostEID;
     PldmTransport pldmTransport{};
     auto event = Event::get_default();
     auto& bus = pldm::utils::DBusHandler::getBus();
@@ -293,6 +340,13 @@ int main(int argc, char** argv)
              return platformManager->handlePldmMessagePollEvent(
                  request, payloadLength, formatVersion, tid, eventDataOffset);
          }}},
+        {PLDM_PDR_REPOSITORY_CHG_EVENT,
+         {[&platformManager](const pldm_msg* request, size_t payloadLength,
+                             uint8_t formatVersion, uint8_t tid,
+                             size_t eventDataOffset) {
+             return platformManager->handlePdrRepositoryChgEvent(
+                 request, payloadLength, formatVersion, tid, eventDataOffset);
+         }}},
         {PLDM_SENSOR_EVENT,
          {[&platformManager](const pldm_msg* request, size_t payloadLength,
                              uint8_t formatVersion, uint8_t tid,
@@ -343,6 +397,14 @@ int main(int argc, char** argv)
     std::unique_ptr<pldm::rde::Manager> rdeManager =
         std::make_unique<pldm::rde::Manager>(bus, event, &instanceIdDb,
                                              &reqHandler);
+#ifdef REQUESTER_METRICS
+    dbus_api::RequesterMetrics dbusImplRequesterMetrics(
+        bus, "/xyz/openbmc_project/pldm", reqHandler, instanceIdDb);
+#endif
+#ifdef SENSOR_READINGS
+    dbus_api::SensorReadings dbusImplSensorReadings(
+        bus, "/xyz/openbmc_project/pldm", platformManager->getTermini());
+#endif
     std::unique_ptr<fw_update::Manager> fwManager =
         std::make_unique<fw_update::Manager>(event, reqHandler, instanceIdDb);
     std::unique_ptr<MctpDiscovery> mctpDiscoveryHandler =
@@ -351,7 +413,8 @@ int main(int argc, char** argv)
                      fwManager.get(), platformManager.get()});
 
     auto callback = [verbose, &invoker, &reqHandler, &fwManager, &pldmTransport,
-                     TID](IO& io, int fd, uint32_t revents) mutable {
+                     response = Response{}](IO& io, int fd,
+                                            uint32_t revents) mutable {
         if (!(revents & EPOLLIN))
         {
             return;
@@ -361,44 +424,43 @@ int main(int argc, char** argv)
             return;
         }
 
-        int returnCode = 0;
-        void* requestMsg;
-        size_t recvDataLength;
-        returnCode = pldmTransport.recvMsg(TID, requestMsg, recvDataLength);
-
-        if (returnCode == PLDM_REQUESTER_SUCCESS)
-        {
-            std::vector<uint8_t> requestMsgVec(
-                static_cast<uint8_t*>(requestMsg),
-                static_cast<uint8_t*>(requestMsg) + recvDataLength);
-            FlightRecorder::GetInstance().saveRecord(requestMsgVec, false);
-            if (verbose)
-            {
-                printBuffer(Rx, requestMsgVec);
-            }
-            // process message and send response
-            auto response = processRxMsg(requestMsgVec, invoker, reqHandler,
-                                         fwManager.get(), TID);
-            if (response.has_value())
-            {
-                FlightRecorder::GetInstance().saveRecord(*response, true);
+        // drain the pending messages, up to the budget, on this wakeup
+        auto returnCode = pldmTransport.recvMsgs(
+            TRANSPORT_RECV_BUDGET,
+            [&](pldm_tid_t tid, const void* requestMsg, size_t recvDataLength) {
+                // the message is processed in place in the transport buffer
+                std::span<const uint8_t> requestMsgSpan(
+                    static_cast<const uint8_t*>(requestMsg), recvDataLength);
+                FlightRecorder::GetInstance().saveRecord(requestMsgSpan, false,
+                                                         tid);
                 if (verbose)
                 {
-                    printBuffer(Tx, *response);
+                    printBuffer(Rx, requestMsgSpan);
                 }
-
-                returnCode = pldmTransport.sendMsg(TID, (*response).data(),
-                                                   (*response).size());
-                if (returnCode != PLDM_REQUESTER_SUCCESS)
+                // process message and send response
+                if (processRxMsg(requestMsgSpan, invoker, reqHandler,
+                                 fwManager.get(), tid, response))
                 {
-                    warning(
-                        "Failed to send pldmTransport message for TID '{TID}', response code '{RETURN_CODE}'",
-                        "TID", TID, "RETURN_CODE", returnCode);
+                    FlightRecorder::GetInstance().saveRecord(response, true,
+                                                             tid);
+                    if (verbose)
+                    {
+                        printBuffer(Tx, response);
+                    }
+
+                    auto rc = pldmTransport.sendMsg(tid, response.data(),
+                                                    response.size());
+                    if (rc != PLDM_REQUESTER_SUCCESS)
+                    {
+                        warning(
+                            "Failed to send pldmTransport message for TID '{TID}', response code '{RETURN_CODE}'",
+                            "TID", tid, "RETURN_CODE", rc);
+                    }
                 }
-            }
-        }
+            });
+
         // TODO check that we get here if mctp-demux dies?
-        else if (returnCode == PLDM_REQUESTER_RECV_FAIL)
+        if (returnCode == PLDM_REQUESTER_RECV_FAIL)
         {
             // MCTP daemon has closed the socket this daemon is connected to.
             // This may or may not be an error scenario, in either case the
@@ -410,14 +472,12 @@ int main(int argc, char** argv)
                 "RC", returnCode);
             io.get_event().exit(0);
         }
-        else
+        else if (returnCode != PLDM_REQUESTER_SUCCESS)
         {
             warning(
                 "Failed to receive PLDM request for pldmTransport, response code '{RETURN_CODE}'",
                 "RETURN_CODE", returnCode);
         }
-        /* Free requestMsg after using */
-        free(requestMsg);
     };
 
     bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
@@ -0,0 +1,156 @@
+#include "pldm_metrics_cmd.hpp"
+
+#include "common/utils.hpp"
+#include "pldm_cmd_helper.hpp"
+#include "requester/metrics.hpp"
+
+#include <sdbusplus/bus.hpp>
+
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace pldmtool
+{
+
+namespace metrics
+{
+
+namespace
+{
+
+using namespace pldmtool::helper;
+using namespace pldm::requester;
+
+constexpr auto pldmService = "xyz.openbmc_project.PLDM";
+constexpr auto pldmObjPath = "/xyz/openbmc_project/pldm";
+
+bool resetMetrics = false;
+
+/** @brief Call a method of the PLDM daemon requester metrics interface
+ *
+ *  @param[in] method - the method name
+ *
+ *  @return the reply message
+ */
+sdbusplus::message_t callMetricsMethod(const char* method)
+{
+    auto& bus = pldm::utils::DBusHandler::getBus();
+    auto call = bus.new_method_call(pldmService, pldmObjPath,
+                                    requesterMetricsInterface, method);
+    return bus.call(call, dbusTimeout);
+}
+
+/** @brief Convert a latency histogram to JSON
+ *
+ *  @param[in] total - sum of the samples in microseconds
+ *  @param[in] max - longest sample in microseconds
+ *  @param[in] buckets - sample counts of the buckets
+ *  @param[in] count - number of samples
+ *
+ *  @return the histogram in JSON format
+ */
+ordered_json histogramToJson(uint64_t total, uint32_t max,
+                             const std::vector<uint32_t>& buckets,
+                             uint32_t count)
+{
+    ordered_json histogram;
+    histogram["AverageUs"] = count ? total / count : 0;
+    histogram["MaxUs"] = max;
+
+    ordered_json bucketData;
+    for (size_t i = 0; i < buckets.size(); i++)
+    {
+        auto name = i < latencyBucketBounds.size()
+                        ? std::format("<={}us", latencyBucketBounds[i])
+                        : std::format(">{}us", latencyBucketBounds.back());
+        bucketData[name] = buckets[i];
+    }
+    histogram["Buckets"] = bucketData;
+    return histogram;
+}
+
+void dumpMetrics()
+{
+    std::vector<EndpointMetricsRecord> endpoints;
+    std::vector<CommandMetricsRecord> commands;
+    try
+    {
+        callMetricsMethod("GetEndpointMetrics").read(endpoints);
+        callMetricsMethod("GetCommandMetrics").read(commands);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to get the requester metrics, error - "
+                  << e.what() << "\n";
+        return;
+    }
+
+    ordered_json data;
+    data["Endpoints"] = ordered_json::array();
+    for (const auto& [eid, exhaustions, timeOut] : endpoints)
+    {
+        ordered_json endpoint;
+        endpoint["EID"] = eid;
+        endpoint["InstanceIdExhaustions"] = exhaustions;
+        endpoint["ResponseTimeOutMs"] = timeOut;
+        data["Endpoints"].emplace_back(endpoint);
+    }
+
+    data["Commands"] = ordered_json::array();
+    for (const auto& [eid, type, command, requests, responses, retries,
+                      timeouts, responseTotal, responseMax, responseBuckets,
+                      queueTotal, queueMax, queueBuckets] : commands)
+    {
+        ordered_json commandData;
+        commandData["EID"] = eid;
+        commandData["PLDMType"] = type;
+        commandData["Command"] = command;
+        commandData["Requests"] = requests;
+        commandData["Responses"] = responses;
+        commandData["Retries"] = retries;
+        commandData["Timeouts"] = timeouts;
+        commandData["ResponseLatency"] = histogramToJson(
+            responseTotal, responseMax, responseBuckets, responses);
+        commandData["QueueLatency"] =
+            histogramToJson(queueTotal, queueMax, queueBuckets, requests);
+        data["Commands"].emplace_back(commandData);
+    }
+
+    DisplayInJson(data);
+}
+
+void exec()
+{
+    if (resetMetrics)
+    {
+        try
+        {
+            callMetricsMethod("Reset");
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Failed to reset the requester metrics, error - "
+                      << e.what() << "\n";
+        }
+        return;
+    }
+
+    dumpMetrics();
+}
+
+} // namespace
+
+void registerCommand(CLI::App& app)
+{
+    auto metrics = app.add_subcommand(
+        "metrics", "dump the request metrics of the PLDM daemon requester");
+    metrics->add_flag("-r,--reset", resetMetrics,
+                      "reset the request metrics instead of dumping them");
+    metrics->callback(exec);
+}
+
+} // namespace metrics
+
+} // namespace pldmtool
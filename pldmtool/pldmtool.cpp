@@ -3,6 +3,7 @@
 #include "pldm_cmd_helper.hpp"
 #include "pldm_fru_cmd.hpp"
 #include "pldm_fw_update_cmd.hpp"
+#include "pldm_metrics_cmd.hpp"
 #include "pldm_platform_cmd.hpp"
 #include "pldmtool/oem/ibm/pldm_oem_ibm.hpp"
 
@@ -131,6 +132,7 @@ int main(int argc, char** argv)
     pldmtool::fru::registerCommand(app);
     pldmtool::fw_update::registerCommand(app);
     pldmtool::rde::registerCommand(app);
+    pldmtool::metrics::registerCommand(app);
 
 #ifdef OEM_IBM
     pldmtool::oem_ibm::registerCommand(app);
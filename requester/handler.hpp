@@ -3,26 +3,34 @@
 #include "common/instance_id.hpp"
 #include "common/transport.hpp"
 #include "common/types.hpp"
+#include "metrics.hpp"
 #include "request.hpp"
 
 #include <libpldm/base.h>
+#include <libpldm/platform.h>
 #include <sys/socket.h>
 
 #include <phosphor-logging/lg2.hpp>
 #include <sdbusplus/async.hpp>
 #include <sdbusplus/timer.hpp>
 #include <sdeventplus/event.hpp>
+#include <sdeventplus/source/base.hpp>
 #include <sdeventplus/source/event.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <deque>
 #include <functional>
+#include <limits>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <tuple>
-#include <unordered_map>
+#include <vector>
 
 PHOSPHOR_LOG2_USING;
 
@@ -50,20 +58,6 @@ struct RequestKey
     }
 };
 
-/** @struct RequestKeyHasher
- *
- *  This is a simple hash function, since the instance ID generator API
- *  generates unique instance IDs for MCTP endpoint ID.
- */
-struct RequestKeyHasher
-{
-    std::size_t operator()(const RequestKey& key) const
-    {
-        return (key.eid << 24 | key.instanceId << 16 | key.type << 8 |
-                key.command);
-    }
-};
-
 using ResponseHandler = std::function<void(
     mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen)>;
 
@@ -78,6 +72,62 @@ using ResponseHandler = std::function<void(
  */
 using SendRecvCoResp = std::tuple<int, const pldm_msg*, size_t>;
 
+/** @enum RequestPriority
+ *
+ *  The priority classes of the requests queued to one endpoint. A lower value
+ *  is sent first.
+ */
+enum class RequestPriority : uint8_t
+{
+    Control = 0, //!< Power and host control, e.g. SetStateEffecterStates
+    Event,       //!< Platform event messages and event receiver setup
+    Polling,     //!< Periodic reads, e.g. GetSensorReading
+    Bulk,        //!< Bulk transfers, e.g. GetPDR and firmware update
+};
+
+/** @brief Number of request priority classes */
+constexpr size_t numRequestPriorities =
+    static_cast<size_t>(RequestPriority::Bulk) + 1;
+
+/** @brief Number of times queued requests of a priority class are passed over
+ *         by higher classes before one of them is sent regardless of priority
+ */
+constexpr uint8_t requestStarvationLimit = 8;
+
+/** @brief Get the default priority class of a PLDM request
+ *
+ *  @param[in] type - PLDM type
+ *  @param[in] command - PLDM command
+ *
+ *  @return the priority class of the request
+ */
+inline RequestPriority getDefaultRequestPriority(uint8_t type, uint8_t command)
+{
+    switch (type)
+    {
+        case PLDM_PLATFORM:
+            switch (command)
+            {
+                case PLDM_SET_STATE_EFFECTER_STATES:
+                case PLDM_SET_NUMERIC_EFFECTER_VALUE:
+                    return RequestPriority::Control;
+                case PLDM_SET_EVENT_RECEIVER:
+                case PLDM_PLATFORM_EVENT_MESSAGE:
+                case PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE:
+                    return RequestPriority::Event;
+                case PLDM_GET_PDR:
+                    return RequestPriority::Bulk;
+                default:
+                    return RequestPriority::Polling;
+            }
+        case PLDM_FRU:
+        case PLDM_FWUP:
+            return RequestPriority::Bulk;
+        default:
+            return RequestPriority::Polling;
+    }
+}
+
 /** @struct RegisteredRequest
  *
  *  This struct is used to store the registered request to one endpoint.
@@ -87,25 +137,205 @@ struct RegisteredRequest
     RequestKey key;                  //!< Responder MCTP endpoint ID
     std::vector<uint8_t> reqMsg;     //!< Request messages queue
     ResponseHandler responseHandler; //!< Waiting for response flag
+    RequestPriority priority;        //!< Priority class of the request
+    std::chrono::steady_clock::time_point registerTime; //!< Queuing time
 };
 
+/** @brief List of registered requests, the nodes are moved between the request
+ *         queues and the free list of the Handler with splice so that queuing
+ *         a request does not allocate once the list nodes exist
+ */
+using RegisteredRequestList = std::list<RegisteredRequest>;
+
 /** @struct EndpointMessageQueue
  *
  *  This struct is used to save the list of request messages of one endpoint and
- *  the existing of the request message to the endpoint with its' EID.
+ *  the existing of the request message to the endpoint with its' EID. The
+ *  requests are kept in one queue per priority class.
  */
 struct EndpointMessageQueue
 {
     mctp_eid_t eid; //!< Responder MCTP endpoint ID
-    std::deque<std::shared_ptr<RegisteredRequest>> requestQueue; //!< Queue
-    bool activeRequest; //!< Waiting for response flag
+    std::array<RegisteredRequestList, numRequestPriorities>
+        requestQueues; //!< Queue per priority class
+    std::array<uint8_t, numRequestPriorities>
+        bypassCounts;       //!< Times each class was passed over
+    uint8_t activeRequests; //!< Number of requests waiting for response
 
     bool operator==(const mctp_eid_t& mctpEid) const
     {
         return (eid == mctpEid);
     }
+
+    /** @brief Check if there is no queued request */
+    bool empty() const
+    {
+        return std::ranges::all_of(requestQueues, [](const auto& queue) {
+            return queue.empty();
+        });
+    }
+
+    /** @brief Queue a request in the queue of its priority class
+     *
+     *  @param[in] source - the list holding the request
+     *  @param[in] request - the request to be moved to the queue
+     */
+    void push(RegisteredRequestList& source,
+              RegisteredRequestList::iterator request)
+    {
+        auto& queue = requestQueues[static_cast<size_t>(request->priority)];
+        queue.splice(queue.end(), source, request);
+    }
+
+    /** @brief Dequeue the next request to be sent
+     *
+     *  The request is taken from the highest priority class, unless a lower
+     *  class has been passed over requestStarvationLimit times.
+     *
+     *  @param[in] destination - the list receiving the request at its front
+     *
+     *  @return true if a request was moved to the destination
+     */
+    bool pop(RegisteredRequestList& destination)
+    {
+        auto selected = numRequestPriorities;
+        for (size_t i = 0; i < numRequestPriorities; i++)
+        {
+            if (!requestQueues[i].empty() &&
+                bypassCounts[i] >= requestStarvationLimit)
+            {
+                selected = i;
+                break;
+            }
+        }
+
+        if (selected == numRequestPriorities)
+        {
+            for (size_t i = 0; i < numRequestPriorities; i++)
+            {
+                if (!requestQueues[i].empty())
+                {
+                    selected = i;
+                    break;
+                }
+            }
+        }
+
+        if (selected == numRequestPriorities)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < numRequestPriorities; i++)
+        {
+            if (i != selected && !requestQueues[i].empty())
+            {
+                bypassCounts[i]++;
+            }
+        }
+        bypassCounts[selected] = 0;
+
+        auto& queue = requestQueues[selected];
+        destination.splice(destination.begin(), queue, queue.begin());
+        return true;
+    }
+
+    /** @brief Remove a queued request
+     *
+     *  @param[in] key - key of the request
+     *  @param[in] destination - the list receiving the removed request
+     *
+     *  @return true if the request was queued
+     */
+    bool erase(const RequestKey& key, RegisteredRequestList& destination)
+    {
+        for (size_t i = 0; i < numRequestPriorities; i++)
+        {
+            auto& queue = requestQueues[i];
+            auto it = std::ranges::find_if(queue, [&key](const auto& request) {
+                return request.key == key;
+            });
+            if (it != queue.end())
+            {
+                destination.splice(destination.begin(), queue, it);
+                if (queue.empty())
+                {
+                    bypassCounts[i] = 0;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/** @struct RttEstimator
+ *
+ *  The round trip time estimate of an endpoint, smoothed the way RFC 6298
+ *  computes the TCP retransmission timeout.
+ */
+struct RttEstimator
+{
+    std::chrono::microseconds srtt{};   //!< smoothed round trip time
+    std::chrono::microseconds rttvar{}; //!< round trip time variation
+    bool valid = false;                 //!< at least one sample was taken
+
+    /** @brief Add a round trip time sample to the estimate
+     *
+     *  @param[in] rtt - measured round trip time of a request
+     */
+    void update(std::chrono::microseconds rtt)
+    {
+        if (!valid)
+        {
+            srtt = rtt;
+            rttvar = rtt / 2;
+            valid = true;
+            return;
+        }
+
+        auto delta = srtt > rtt ? srtt - rtt : rtt - srtt;
+        rttvar = (3 * rttvar + delta) / 4;
+        srtt = (7 * srtt + rtt) / 8;
+    }
+
+    /** @brief Discard the estimate, e.g. when a request got no response */
+    void invalidate()
+    {
+        valid = false;
+    }
+
+    /** @brief Get the response timeout derived from the estimate
+     *
+     *  @param[in] minTimeOut - lower bound of the timeout
+     *  @param[in] maxTimeOut - upper bound of the timeout
+     *
+     *  @return SRTT + 4 * RTTVAR clamped to [minTimeOut, maxTimeOut],
+     *          maxTimeOut if no sample was taken
+     */
+    std::chrono::milliseconds
+        timeOut(std::chrono::milliseconds minTimeOut,
+                std::chrono::milliseconds maxTimeOut) const
+    {
+        if (!valid)
+        {
+            return maxTimeOut;
+        }
+
+        auto rto = std::chrono::ceil<std::chrono::milliseconds>(
+            srtt + 4 * rttvar);
+        return std::clamp(rto, std::min(minTimeOut, maxTimeOut), maxTimeOut);
+    }
 };
 
+/** @brief The maximum number of outstanding requests to one endpoint, bounded
+ *         by the 5-bit PLDM instance ID space
+ */
+constexpr uint8_t maxOutstandingRequestsLimit = PLDM_INSTANCE_MAX + 1;
+
+/** @brief Number of MCTP endpoint IDs */
+constexpr size_t numEndpointIds = std::numeric_limits<mctp_eid_t>::max() + 1;
+
 /** @class Handler
  *
  *  This class handles the lifecycle of the PLDM request message based on the
@@ -115,6 +345,14 @@ struct EndpointMessageQueue
  *  received within the instance ID expiration interval or any other failure the
  *  response handler is invoked with the empty response.
  *
+ *  Up to maxOutstandingRequests requests are sent to one endpoint before a
+ *  response is received, the remaining requests wait in the endpoint queue.
+ *
+ *  With the adaptive response timeout, the response timeout of an endpoint is
+ *  derived from the round trip times measured on its requests and bounded by
+ *  responseTimeOut. The time to wait doubles after each retry, up to
+ *  responseTimeOut.
+ *
  * @tparam RequestInterface - Request class type
  */
 template <class RequestInterface>
@@ -137,6 +375,8 @@ class Handler
      *  @param[in] instanceIdExpiryInterval - instance ID expiration interval
      *  @param[in] numRetries - number of request retries
      *  @param[in] responseTimeOut - time to wait between each retry
+     *  @param[in] maxOutstandingRequests - default number of requests in
+     *                                      flight to one endpoint
      */
     explicit Handler(
         PldmTransport* pldmTransport, sdeventplus::Event& event,
@@ -145,38 +385,207 @@ class Handler
             std::chrono::seconds(INSTANCE_ID_EXPIRATION_INTERVAL),
         uint8_t numRetries = static_cast<uint8_t>(NUMBER_OF_REQUEST_RETRIES),
         std::chrono::milliseconds responseTimeOut =
-            std::chrono::milliseconds(RESPONSE_TIME_OUT)) :
+            std::chrono::milliseconds(RESPONSE_TIME_OUT),
+        uint8_t maxOutstandingRequests =
+            static_cast<uint8_t>(MAX_OUTSTANDING_REQUESTS_PER_ENDPOINT)) :
         pldmTransport(pldmTransport), event(event), instanceIdDb(instanceIdDb),
         verbose(verbose), instanceIdExpiryInterval(instanceIdExpiryInterval),
-        numRetries(numRetries), responseTimeOut(responseTimeOut)
-    {}
+        numRetries(numRetries), responseTimeOut(responseTimeOut),
+        maxOutstandingRequests(
+            std::clamp<uint8_t>(maxOutstandingRequests, 1,
+                                maxOutstandingRequestsLimit)),
+        minResponseTimeOut(std::chrono::milliseconds(MIN_RESPONSE_TIME_OUT)),
+        expiredRequestsDefer(event, [this](sdeventplus::source::EventBase&) {
+            removeExpiredRequests();
+        })
+    {
+        expiredRequestsDefer.set_enabled(sdeventplus::source::Enabled::Off);
+    }
+
+    /** @brief Set the number of requests allowed in flight to an endpoint
+     *
+     *  Termini which can process concurrent commands are given a wider window
+     *  so that several requests are sent before the first response arrives.
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *  @param[in] count - number of outstanding requests, clamped to
+     *                     [1, maxOutstandingRequestsLimit]
+     */
+    void setMaxOutstandingRequests(mctp_eid_t eid, uint8_t count)
+    {
+        outstandingRequestsWindow[eid] =
+            std::clamp<uint8_t>(count, 1, maxOutstandingRequestsLimit);
+
+        if (endpointMessageQueues[eid])
+        {
+            /* the window may have been widened, send the queued requests */
+            pollEndpointQueue(eid);
+        }
+    }
+
+    /** @brief Get the number of requests allowed in flight to an endpoint
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *
+     *  @return the outstanding request window of the endpoint
+     */
+    uint8_t getMaxOutstandingRequests(mctp_eid_t eid) const
+    {
+        auto window = outstandingRequestsWindow[eid];
+        return window ? window : maxOutstandingRequests;
+    }
+
+    /** @brief Enable or disable the adaptive response timeout
+     *
+     *  @param[in] enable - derive the response timeout of the endpoints from
+     *                      their measured round trip times
+     *  @param[in] minTimeOut - lower bound of the adaptive response timeout
+     */
+    void setAdaptiveResponseTimeOut(bool enable,
+                                    std::chrono::milliseconds minTimeOut)
+    {
+        adaptiveResponseTimeOut = enable;
+        minResponseTimeOut = minTimeOut;
+    }
+
+    /** @brief Get the time to wait for the response of a request to an
+     *         endpoint before the first retry
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *
+     *  @return the response timeout of the endpoint
+     */
+    std::chrono::milliseconds getResponseTimeOut(mctp_eid_t eid) const
+    {
+        if (!adaptiveResponseTimeOut)
+        {
+            return responseTimeOut;
+        }
+        return rttEstimators[eid].timeOut(minResponseTimeOut, responseTimeOut);
+    }
+
+    /** @brief Get the time after which a request to an endpoint which got no
+     *         response fails
+     *
+     *  With the adaptive response timeout, a request fails once the backoff
+     *  after its last retry expires, bounded by the instance ID expiration
+     *  interval. Its instance ID stays in use until the interval expires.
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *
+     *  @return the failure timeout of the endpoint
+     */
+    std::chrono::milliseconds getFailureTimeOut(mctp_eid_t eid) const
+    {
+        auto expiry = std::chrono::duration_cast<std::chrono::milliseconds>(
+            instanceIdExpiryInterval);
+        if (!adaptiveResponseTimeOut)
+        {
+            return expiry;
+        }
+
+        auto wait = getResponseTimeOut(eid);
+        auto maxWait = std::max(responseTimeOut, wait);
+        std::chrono::milliseconds schedule{};
+        for (int retry = 0; retry <= numRetries && schedule < expiry; retry++)
+        {
+            schedule += wait;
+            wait = std::min(wait * 2, maxWait);
+        }
+        return std::min(schedule, expiry);
+    }
+
+    /** @brief Get the metrics of the requests sent by the handler
+     *
+     *  @return the request metrics
+     */
+    RequestMetrics& getMetrics()
+    {
+        return metrics;
+    }
+
+    /** @brief Get the metrics of the endpoints the requests were sent to
+     *
+     *  @return the endpoint metrics records ordered by EID
+     */
+    std::vector<EndpointMetricsRecord> getEndpointMetrics() const
+    {
+        std::vector<EndpointMetricsRecord> records;
+        for (size_t eid = 0; eid < numEndpointIds; eid++)
+        {
+            if (metrics.contains(eid))
+            {
+                records.emplace_back(
+                    eid, instanceIdDb.getExhaustedCount(eid),
+                    getResponseTimeOut(eid).count());
+            }
+        }
+        return records;
+    }
 
     void instanceIdExpiryCallBack(RequestKey key)
     {
         auto eid = key.eid;
-        if (this->handlers.contains(key))
+        auto entryPtr = findEntry(key);
+        if (entryPtr && entryPtr->expired)
+        {
+            /* the request failed before, its instance ID expired now */
+            expiredRequests.push_back(key);
+            expiredRequestsDefer.set_enabled(
+                sdeventplus::source::Enabled::OneShot);
+        }
+        else if (entryPtr)
         {
             info(
                 "Instance ID expiry for EID '{EID}' using InstanceID '{INSTANCEID}'",
                 "EID", key.eid, "INSTANCEID", key.instanceId);
-            auto& [request, responseHandler,
-                   timerInstance] = this->handlers[key];
-            request->stop();
-            auto rc = timerInstance->stop();
+            auto& entry = *entryPtr;
+            entry.request->stop();
+            auto rc = entry.timer->stop();
             if (rc)
             {
                 error(
                     "Failed to stop the instance ID expiry timer, response code '{RC}'",
                     "RC", rc);
             }
+            entry.expired = true;
+            entry.metrics->timeouts++;
+            entry.metrics->retries += entry.request->getRetryCount();
+            /* fall back to responseTimeOut until the endpoint responds again */
+            rttEstimators[eid].invalidate();
             // Call response handler with an empty response to indicate no
             // response
-            responseHandler(eid, nullptr, 0);
-            this->removeRequestContainer.emplace(
-                key,
-                std::make_unique<sdeventplus::source::Defer>(
-                    event, std::bind(&Handler::removeRequestEntry, this, key)));
-            endpointMessageQueues[eid]->activeRequest = false;
+            entry.responseHandler(eid, nullptr, 0);
+
+            /* a request failed before the instance ID expiration interval
+             * keeps its instance ID until the interval expires, a late
+             * response is ignored */
+            auto remaining =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    entry.sendTime + instanceIdExpiryInterval -
+                    std::chrono::steady_clock::now());
+            bool instanceIdInUse = false;
+            if (remaining.count() > 0)
+            {
+                try
+                {
+                    entry.timer->start(remaining);
+                    instanceIdInUse = true;
+                }
+                catch (const std::runtime_error& e)
+                {
+                    error(
+                        "Failed to restart the instance ID expiry timer, error - {ERROR}",
+                        "ERROR", e);
+                }
+            }
+            if (!instanceIdInUse)
+            {
+                expiredRequests.push_back(key);
+                expiredRequestsDefer.set_enabled(
+                    sdeventplus::source::Enabled::OneShot);
+            }
+            releaseActiveRequest(eid);
 
             /* try to send new request if the endpoint is free */
             pollEndpointQueue(eid);
@@ -191,63 +600,56 @@ class Handler
     }
 
     /** @brief Send the remaining PLDM request messages in endpoint queue
+     *
+     *  Requests are sent until the outstanding request window of the endpoint
+     *  is full or the queue is empty. A request which fails to be sent is
+     *  completed with an empty response, like a request which timed out, and
+     *  the requests queued behind it are still sent.
      *
      *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *  @param[in] registeredKey - key of the request being registered, which
+     *                             is not completed on failure since the
+     *                             failure is returned to its caller
+     *
+     *  @return PLDM_SUCCESS unless the request of registeredKey failed to be
+     *          sent
      */
-    int pollEndpointQueue(mctp_eid_t eid)
+    int pollEndpointQueue(mctp_eid_t eid,
+                          std::optional<RequestKey> registeredKey = {})
     {
-        if (endpointMessageQueues[eid]->activeRequest ||
-            endpointMessageQueues[eid]->requestQueue.empty())
-        {
-            return PLDM_SUCCESS;
-        }
-
-        endpointMessageQueues[eid]->activeRequest = true;
-        auto requestMsg = endpointMessageQueues[eid]->requestQueue.front();
-        endpointMessageQueues[eid]->requestQueue.pop_front();
-
-        auto request = std::make_unique<RequestInterface>(
-            pldmTransport, requestMsg->key.eid, event,
-            std::move(requestMsg->reqMsg), numRetries, responseTimeOut,
-            verbose);
-        auto timer = std::make_unique<sdbusplus::Timer>(
-            event.get(), std::bind(&Handler::instanceIdExpiryCallBack, this,
-                                   requestMsg->key));
+        auto& endpointQueue = endpointMessageQueues[eid];
+        auto window = getMaxOutstandingRequests(eid);
+        int ret = PLDM_SUCCESS;
 
-        auto rc = request->start();
-        if (rc)
+        while (endpointQueue->activeRequests < window &&
+               !endpointQueue->empty())
         {
-            instanceIdDb.free(requestMsg->key.eid, requestMsg->key.instanceId);
-            error(
-                "Failure to send the PLDM request message for polling endpoint queue, response code '{RC}'",
-                "RC", rc);
-            endpointMessageQueues[eid]->activeRequest = false;
-            return rc;
-        }
-
-        try
-        {
-            timer->start(duration_cast<std::chrono::microseconds>(
-                instanceIdExpiryInterval));
-        }
-        catch (const std::runtime_error& e)
-        {
-            instanceIdDb.free(requestMsg->key.eid, requestMsg->key.instanceId);
-            error(
-                "Failed to start the instance ID expiry timer, error - {ERROR}",
-                "ERROR", e);
-            endpointMessageQueues[eid]->activeRequest = false;
-            return PLDM_ERROR;
+            RequestKey key{};
+            ResponseHandler responseHandler;
+            auto rc = sendQueuedRequest(*endpointQueue, key, responseHandler);
+            if (rc == PLDM_SUCCESS)
+            {
+                continue;
+            }
+            if (registeredKey && key == *registeredKey)
+            {
+                ret = rc;
+            }
+            else if (responseHandler)
+            {
+                // Call response handler with an empty response to indicate
+                // no response
+                responseHandler(eid, nullptr, 0);
+            }
         }
 
-        handlers.emplace(requestMsg->key,
-                         std::make_tuple(std::move(request),
-                                         std::move(requestMsg->responseHandler),
-                                         std::move(timer)));
-        return PLDM_SUCCESS;
+        return ret;
     }
 
     /** @brief Register a PLDM request message
+     *
+     *  The request is queued with the default priority class of its PLDM type
+     *  and command.
      *
      *  @param[in] eid - endpoint ID of the remote MCTP endpoint
      *  @param[in] instanceId - instance ID to match request and response
@@ -261,10 +663,41 @@ class Handler
     int registerRequest(mctp_eid_t eid, uint8_t instanceId, uint8_t type,
                         uint8_t command, pldm::Request&& requestMsg,
                         ResponseHandler&& responseHandler)
+    {
+        return registerRequest(eid, instanceId, type, command,
+                               std::move(requestMsg),
+                               std::move(responseHandler),
+                               getDefaultRequestPriority(type, command));
+    }
+
+    /** @brief Register a PLDM request message with a priority class
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *  @param[in] instanceId - instance ID to match request and response
+     *  @param[in] type - PLDM type
+     *  @param[in] command - PLDM command
+     *  @param[in] requestMsg - PLDM request message
+     *  @param[in] responseHandler - Response handler for this request
+     *  @param[in] priority - priority class of the request
+     *
+     *  @return return PLDM_SUCCESS on success and PLDM_ERROR otherwise
+     */
+    int registerRequest(mctp_eid_t eid, uint8_t instanceId, uint8_t type,
+                        uint8_t command, pldm::Request&& requestMsg,
+                        ResponseHandler&& responseHandler,
+                        RequestPriority priority)
     {
         RequestKey key{eid, instanceId, type, command};
 
-        if (handlers.contains(key))
+        if (instanceId > PLDM_INSTANCE_MAX)
+        {
+            error(
+                "Register request for EID '{EID}' with invalid InstanceID '{INSTANCEID}'",
+                "EID", eid, "INSTANCEID", instanceId);
+            return PLDM_ERROR_INVALID_DATA;
+        }
+
+        if (isEntryInUse(eid, instanceId))
         {
             error(
                 "Register request for EID '{EID}' is using InstanceID '{INSTANCEID}'",
@@ -272,26 +705,32 @@ class Handler
             return PLDM_ERROR;
         }
 
-        auto inputRequest = std::make_shared<RegisteredRequest>(
-            key, std::move(requestMsg), std::move(responseHandler));
-        if (endpointMessageQueues.contains(eid))
+        /* reuse a list node released by a previous request */
+        if (freeRegisteredRequests.empty())
         {
-            endpointMessageQueues[eid]->requestQueue.push_back(inputRequest);
+            freeRegisteredRequests.emplace_front();
         }
-        else
+        auto inputRequest = freeRegisteredRequests.begin();
+        inputRequest->key = key;
+        inputRequest->reqMsg = std::move(requestMsg);
+        inputRequest->responseHandler = std::move(responseHandler);
+        inputRequest->priority = priority;
+        inputRequest->registerTime = std::chrono::steady_clock::now();
+
+        if (!endpointMessageQueues[eid])
         {
-            std::deque<std::shared_ptr<RegisteredRequest>> reqQueue;
-            reqQueue.push_back(inputRequest);
             endpointMessageQueues[eid] =
-                std::make_shared<EndpointMessageQueue>(eid, reqQueue, false);
+                std::make_unique<EndpointMessageQueue>();
+            endpointMessageQueues[eid]->eid = eid;
         }
+        endpointMessageQueues[eid]->push(freeRegisteredRequests, inputRequest);
 
         /* try to send new request if the endpoint is free */
-        auto rc = pollEndpointQueue(eid);
+        auto rc = pollEndpointQueue(eid, key);
         if (rc != PLDM_SUCCESS)
         {
             error(
-                "Failed to process request queue for EID {EID}, response code {RC}.",
+                "Failed to send request for EID {EID}, response code {RC}.",
                 "EID", eid, "RC", rc);
             return rc;
         }
@@ -313,12 +752,20 @@ class Handler
     {
         RequestKey key{eid, instanceId, type, command};
 
-        /* handlers only contain key when the message is already sent */
-        if (handlers.contains(key))
+        /* the request table only contains key when the message is already
+         * sent */
+        auto entryPtr = findEntry(key);
+        if (entryPtr)
         {
-            auto& [request, responseHandler, timerInstance] = handlers[key];
-            request->stop();
-            auto rc = timerInstance->stop();
+            auto& entry = *entryPtr;
+            if (entry.expired)
+            {
+                /* the entry is removed once the expiry is processed */
+                return PLDM_SUCCESS;
+            }
+
+            entry.request->stop();
+            auto rc = entry.timer->stop();
             if (rc)
             {
                 error(
@@ -326,9 +773,10 @@ class Handler
                     "RC", static_cast<int>(rc));
             }
 
+            entry.metrics->retries += entry.request->getRetryCount();
             instanceIdDb.free(key.eid, key.instanceId);
-            handlers.erase(key);
-            endpointMessageQueues[eid]->activeRequest = false;
+            releaseEntry(entry);
+            releaseActiveRequest(eid);
             /* try to send new request if the endpoint is free */
             pollEndpointQueue(eid);
 
@@ -336,29 +784,20 @@ class Handler
         }
         else
         {
-            if (!endpointMessageQueues.contains(eid))
+            if (!endpointMessageQueues[eid])
             {
                 error(
                     "Can't find request for EID '{EID}' is using InstanceID '{INSTANCEID}' in Endpoint message Queue",
                     "EID", (unsigned)eid, "INSTANCEID", (unsigned)instanceId);
                 return PLDM_ERROR;
             }
-            auto requestMsg = endpointMessageQueues[eid]->requestQueue;
-            /* Find the registered request in the requestQueue */
-            for (auto it = requestMsg.begin(); it != requestMsg.end();)
+            /* Find the registered request in the request queues */
+            if (endpointMessageQueues[eid]->erase(key, freeRegisteredRequests))
             {
-                auto msg = *it;
-                if (msg->key == key)
-                {
-                    // erase and get the next valid iterator
-                    it = endpointMessageQueues[eid]->requestQueue.erase(it);
-                    instanceIdDb.free(key.eid, key.instanceId);
-                    return PLDM_SUCCESS;
-                }
-                else
-                {
-                    ++it; // increment iterator only if not erasing
-                }
+                /* drop the captures of the response handler */
+                freeRegisteredRequests.front().responseHandler = nullptr;
+                instanceIdDb.free(key.eid, key.instanceId);
+                return PLDM_SUCCESS;
             }
         }
 
@@ -379,22 +818,34 @@ class Handler
                         size_t respMsgLen)
     {
         RequestKey key{eid, instanceId, type, command};
-        if (handlers.contains(key) && !removeRequestContainer.contains(key))
+        auto entryPtr = findEntry(key);
+        if (entryPtr && !entryPtr->expired)
         {
-            auto& [request, responseHandler, timerInstance] = handlers[key];
-            request->stop();
-            auto rc = timerInstance->stop();
+            auto& entry = *entryPtr;
+            entry.request->stop();
+            auto rc = entry.timer->stop();
             if (rc)
             {
                 error(
                     "Failed to stop the instance ID expiry timer, response code '{RC}'",
                     "RC", rc);
             }
-            responseHandler(eid, response, respMsgLen);
+            auto rtt = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - entry.sendTime);
+            entry.metrics->responses++;
+            entry.metrics->retries += entry.request->getRetryCount();
+            entry.metrics->responseLatency.record(rtt);
+            /* the round trip time of a retried request is ambiguous, it is
+             * not sampled (Karn's algorithm) */
+            if (adaptiveResponseTimeOut && !entry.request->isRetried())
+            {
+                rttEstimators[eid].update(rtt);
+            }
+            entry.responseHandler(eid, response, respMsgLen);
             instanceIdDb.free(key.eid, key.instanceId);
-            handlers.erase(key);
+            releaseEntry(entry);
 
-            endpointMessageQueues[eid]->activeRequest = false;
+            releaseActiveRequest(eid);
             /* try to send new request if the endpoint is free */
             pollEndpointQueue(eid);
         }
@@ -409,6 +860,15 @@ class Handler
     stdexec::sender_of<stdexec::set_value_t(SendRecvCoResp)> auto sendRecvMsg(
         mctp_eid_t eid, pldm::Request&& request);
 
+    /** @brief Wrap registerRequest with a priority class with coroutine API.
+     *
+     *  @return Return [PLDM_ERROR, _, _] if registerRequest fails.
+     *          Return [PLDM_ERROR_NOT_READY, nullptr, 0] if timed out.
+     *          Return [PLDM_SUCCESS, resp, len] if succeeded
+     */
+    stdexec::sender_of<stdexec::set_value_t(SendRecvCoResp)> auto sendRecvMsg(
+        mctp_eid_t eid, pldm::Request&& request, RequestPriority priority);
+
   private:
     PldmTransport* pldmTransport; //!< PLDM transport object
     sdeventplus::Event& event; //!< reference to PLDM daemon's main event loop
@@ -419,42 +879,252 @@ class Handler
     uint8_t numRetries;               //!< number of request retries
     std::chrono::milliseconds
         responseTimeOut;              //!< time to wait between each retry
+    uint8_t maxOutstandingRequests;   //!< default outstanding request window
+#ifdef ADAPTIVE_RESPONSE_TIME_OUT
+    bool adaptiveResponseTimeOut = true; //!< adaptive response timeout flag
+#else
+    bool adaptiveResponseTimeOut = false; //!< adaptive response timeout flag
+#endif
+    std::chrono::milliseconds
+        minResponseTimeOut; //!< lower bound of the adaptive response timeout
+
+    /** @brief Round trip time estimates indexed by MCTP EID */
+    std::array<RttEstimator, numEndpointIds> rttEstimators;
+
+    /** @brief Metrics of the requests sent */
+    RequestMetrics metrics;
 
-    /** @brief Container for storing the details of the PLDM request
-     *         message, handler for the corresponding PLDM response and the
-     *         timer object for the Instance ID expiration
+    /** @brief Outstanding request window overrides indexed by MCTP EID, 0 if
+     *         the endpoint uses the default window
      */
-    using RequestValue =
-        std::tuple<std::unique_ptr<RequestInterface>, ResponseHandler,
-                   std::unique_ptr<sdbusplus::Timer>>;
+    std::array<uint8_t, numEndpointIds> outstandingRequestsWindow{};
+
+    /** @struct RequestEntry
+     *
+     *  The details of the PLDM request message in flight, handler for the
+     *  corresponding PLDM response and the timer object for the Instance ID
+     *  expiration. The request and timer objects are kept when the entry is
+     *  released and reused by a later request with the same EID and instance
+     *  ID.
+     */
+    struct RequestEntry
+    {
+        RequestKey key;                            //!< Key of the request
+        std::unique_ptr<RequestInterface> request; //!< Request retry flow
+        ResponseHandler responseHandler;           //!< Response handler
+        std::unique_ptr<sdbusplus::Timer> timer;   //!< Instance ID expiry
+        std::chrono::steady_clock::time_point sendTime; //!< First send time
+        CommandMetrics* metrics = nullptr; //!< Metrics of the command
+        bool inUse = false;   //!< Request in flight
+        bool expired = false; //!< Instance ID expired, removal pending
+    };
+
+    /** @brief Request entries of one endpoint indexed by instance ID */
+    using EndpointRequestEntries =
+        std::array<RequestEntry, maxOutstandingRequestsLimit>;
 
     // Manage the requests of responders base on MCTP EID
-    std::map<mctp_eid_t, std::shared_ptr<EndpointMessageQueue>>
+    std::array<std::unique_ptr<EndpointMessageQueue>, numEndpointIds>
         endpointMessageQueues;
 
-    /** @brief Container for storing the PLDM request entries */
-    std::unordered_map<RequestKey, RequestValue, RequestKeyHasher> handlers;
+    /** @brief Table of the PLDM request entries indexed by MCTP EID and
+     *         instance ID, the entries of an EID are allocated on its first
+     *         request
+     */
+    std::array<std::unique_ptr<EndpointRequestEntries>, numEndpointIds>
+        requestTable;
 
-    /** @brief Container to store information about the request entries to be
-     *         removed after the instance ID timer expires
+    /** @brief Registered requests which are not queued, reused by the next
+     *         registerRequest
      */
-    std::unordered_map<RequestKey, std::unique_ptr<sdeventplus::source::Defer>,
-                       RequestKeyHasher>
-        removeRequestContainer;
+    RegisteredRequestList freeRegisteredRequests;
+
+    /** @brief Keys of the request entries to be removed after the instance ID
+     *         timer expires
+     */
+    std::vector<RequestKey> expiredRequests;
+
+    /** @brief Event source removing the expired request entries */
+    sdeventplus::source::Defer expiredRequestsDefer;
 
-    /** @brief Remove request entry for which the instance ID expired
+    /** @brief Find the request entry in flight for a key
      *
      *  @param[in] key - key for the Request
+     *
+     *  @return the request entry, nullptr if no request in flight matches the
+     *          EID, instance ID, PLDM type and command of the key
      */
-    void removeRequestEntry(RequestKey key)
+    RequestEntry* findEntry(const RequestKey& key)
     {
-        if (removeRequestContainer.contains(key))
+        const auto& entries = requestTable[key.eid];
+        if (!entries || key.instanceId > PLDM_INSTANCE_MAX)
+        {
+            return nullptr;
+        }
+
+        auto& entry = (*entries)[key.instanceId];
+        if (!entry.inUse || entry.key.type != key.type ||
+            entry.key.command != key.command)
         {
-            removeRequestContainer[key].reset();
+            return nullptr;
+        }
+        return &entry;
+    }
+
+    /** @brief Check if a request is in flight with the EID and instance ID
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *  @param[in] instanceId - PLDM instance ID
+     *
+     *  @return true if the entry of the EID and instance ID is in use
+     */
+    bool isEntryInUse(mctp_eid_t eid, uint8_t instanceId) const
+    {
+        const auto& entries = requestTable[eid];
+        return entries && instanceId <= PLDM_INSTANCE_MAX &&
+               (*entries)[instanceId].inUse;
+    }
+
+    /** @brief Take the request entry of a key into use
+     *
+     *  @param[in] key - key for the Request
+     *
+     *  @return the request entry
+     */
+    RequestEntry& acquireEntry(const RequestKey& key)
+    {
+        auto& entries = requestTable[key.eid];
+        if (!entries)
+        {
+            entries = std::make_unique<EndpointRequestEntries>();
+        }
+
+        auto& entry = (*entries)[key.instanceId];
+        if (!entry.timer)
+        {
+            entry.timer = std::make_unique<sdbusplus::Timer>(
+                event.get(),
+                [this, &entry] { instanceIdExpiryCallBack(entry.key); });
+        }
+        entry.key = key;
+        entry.inUse = true;
+        return entry;
+    }
+
+    /** @brief Release a request entry and keep it for reuse
+     *
+     *  @param[in] entry - the request entry
+     */
+    void releaseEntry(RequestEntry& entry)
+    {
+        entry.responseHandler = nullptr;
+        entry.inUse = false;
+        entry.expired = false;
+    }
+
+    /** @brief Send the request at the front of the endpoint queue
+     *
+     *  @param[in] endpointQueue - the message queue of the endpoint
+     *  @param[out] key - key of the request
+     *  @param[out] responseHandler - response handler of the request if it
+     *                                failed to be sent
+     *
+     *  @return return PLDM_SUCCESS on success and PLDM_ERROR otherwise
+     */
+    int sendQueuedRequest(EndpointMessageQueue& endpointQueue, RequestKey& key,
+                          ResponseHandler& responseHandler)
+    {
+        endpointQueue.activeRequests++;
+        endpointQueue.pop(freeRegisteredRequests);
+        auto& requestMsg = freeRegisteredRequests.front();
+        key = requestMsg.key;
+
+        auto& entry = acquireEntry(key);
+        auto timeOut = getResponseTimeOut(key.eid);
+        if (entry.request)
+        {
+            entry.request->reset(key.eid, std::move(requestMsg.reqMsg),
+                                 numRetries, timeOut);
+        }
+        else
+        {
+            entry.request = std::make_unique<RequestInterface>(
+                pldmTransport, key.eid, event, std::move(requestMsg.reqMsg),
+                numRetries, timeOut, verbose);
+        }
+        entry.request->setMaxTimeout(responseTimeOut);
+        entry.responseHandler = std::move(requestMsg.responseHandler);
+        requestMsg.responseHandler = nullptr;
+
+        entry.sendTime = std::chrono::steady_clock::now();
+        entry.metrics = &metrics.get(key.eid, key.type, key.command);
+        auto rc = entry.request->start();
+        if (rc)
+        {
+            instanceIdDb.free(key.eid, key.instanceId);
+            error(
+                "Failure to send the PLDM request message for polling endpoint queue, response code '{RC}'",
+                "RC", rc);
+            endpointQueue.activeRequests--;
+            responseHandler = std::move(entry.responseHandler);
+            releaseEntry(entry);
+            return rc;
+        }
+
+        try
+        {
+            entry.timer->start(duration_cast<std::chrono::microseconds>(
+                getFailureTimeOut(key.eid)));
+        }
+        catch (const std::runtime_error& e)
+        {
+            entry.request->stop();
             instanceIdDb.free(key.eid, key.instanceId);
-            handlers.erase(key);
-            removeRequestContainer.erase(key);
+            error(
+                "Failed to start the instance ID expiry timer, error - {ERROR}",
+                "ERROR", e);
+            endpointQueue.activeRequests--;
+            responseHandler = std::move(entry.responseHandler);
+            releaseEntry(entry);
+            return PLDM_ERROR;
+        }
+
+        entry.metrics->requests++;
+        entry.metrics->queueLatency.record(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                entry.sendTime - requestMsg.registerTime));
+
+        return PLDM_SUCCESS;
+    }
+
+    /** @brief Release one slot of the outstanding request window of an
+     *         endpoint
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     */
+    void releaseActiveRequest(mctp_eid_t eid)
+    {
+        auto& endpointQueue = endpointMessageQueues[eid];
+        if (endpointQueue->activeRequests)
+        {
+            endpointQueue->activeRequests--;
+        }
+    }
+
+    /** @brief Remove the request entries for which the instance ID expired
+     */
+    void removeExpiredRequests()
+    {
+        for (const auto& key : expiredRequests)
+        {
+            auto entry = findEntry(key);
+            if (entry && entry->expired)
+            {
+                instanceIdDb.free(key.eid, key.instanceId);
+                releaseEntry(*entry);
+            }
         }
+        expiredRequests.clear();
     }
 };
 
@@ -472,6 +1142,7 @@ struct SendRecvMsgOperation
 
     explicit SendRecvMsgOperation(Handler<RequestInterface>& handler,
                                   mctp_eid_t eid, pldm::Request&& request,
+                                  std::optional<RequestPriority> priority,
                                   R&& r) :
         handler(handler), request(std::move(request)), receiver(std::move(r))
     {
@@ -483,6 +1154,8 @@ struct SendRecvMsgOperation
             requestMsg->hdr.type,
             requestMsg->hdr.command,
         };
+        this->priority = priority.value_or(getDefaultRequestPriority(
+            requestKey.type, requestKey.command));
         response = nullptr;
         respMsgLen = 0;
     }
@@ -510,7 +1183,8 @@ struct SendRecvMsgOperation
         auto rc = op.handler.registerRequest(
             op.requestKey.eid, op.requestKey.instanceId, op.requestKey.type,
             op.requestKey.command, std::move(op.request),
-            std::bind(&SendRecvMsgOperation::onComplete, &op, _1, _2, _3));
+            std::bind(&SendRecvMsgOperation::onComplete, &op, _1, _2, _3),
+            op.priority);
         if (rc)
         {
             return stdexec::set_value(std::move(op.receiver), rc,
@@ -569,6 +1243,10 @@ struct SendRecvMsgOperation
      */
     RequestKey requestKey;
 
+    /** @brief The priority class of the request.
+     */
+    RequestPriority priority;
+
     /** @brief The request message to be sent.
      */
     pldm::Request request;
@@ -606,9 +1284,12 @@ struct SendRecvMsgSender
 
     SendRecvMsgSender() = delete;
 
-    explicit SendRecvMsgSender(requester::Handler<RequestInterface>& handler,
-                               mctp_eid_t eid, pldm::Request&& request) :
-        handler(handler), eid(eid), request(std::move(request))
+    explicit SendRecvMsgSender(
+        requester::Handler<RequestInterface>& handler, mctp_eid_t eid,
+        pldm::Request&& request,
+        std::optional<RequestPriority> priority = std::nullopt) :
+        handler(handler), eid(eid), request(std::move(request)),
+        priority(priority)
     {}
 
     friend auto tag_invoke(stdexec::get_completion_signatures_t,
@@ -622,7 +1303,8 @@ struct SendRecvMsgSender
     friend auto tag_invoke(stdexec::connect_t, SendRecvMsgSender&& self, R r)
     {
         return SendRecvMsgOperation<RequestInterface, R>(
-            self.handler, self.eid, std::move(self.request), std::move(r));
+            self.handler, self.eid, std::move(self.request), self.priority,
+            std::move(r));
     }
 
   private:
@@ -636,6 +1318,11 @@ struct SendRecvMsgSender
 
     /** @brief Request message */
     pldm::Request request;
+
+    /** @brief Priority class of the request, the default class of the PLDM
+     *         type and command if not set
+     */
+    std::optional<RequestPriority> priority;
 };
 
 /** @brief Wrap registerRequest with coroutine API.
@@ -658,6 +1345,27 @@ stdexec::sender_of<stdexec::set_value_t(SendRecvCoResp)> auto
            });
 }
 
+/** @brief Wrap registerRequest with a priority class with coroutine API.
+ *
+ *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+ *  @param[in] request - PLDM request message
+ *  @param[in] priority - priority class of the request
+ *
+ *  @return Return [PLDM_ERROR, _, _] if registerRequest fails.
+ *          Return [PLDM_ERROR_NOT_READY, nullptr, 0] if timed out.
+ *          Return [PLDM_SUCCESS, resp, len] if succeeded
+ */
+template <class RequestInterface>
+stdexec::sender_of<stdexec::set_value_t(SendRecvCoResp)> auto
+    Handler<RequestInterface>::sendRecvMsg(
+        mctp_eid_t eid, pldm::Request&& request, RequestPriority priority)
+{
+    return SendRecvMsgSender(*this, eid, std::move(request), priority) |
+           stdexec::then([](int rc, const pldm_msg* resp, size_t respLen) {
+               return std::make_tuple(rc, resp, respLen);
+           });
+}
+
 } // namespace requester
 
 } // namespace pldm
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace pldm
+{
+namespace requester
+{
+
+/** @brief D-Bus interface exposing the requester metrics, defined in
+ *         yaml/pldm/RequesterMetrics.interface.yaml
+ */
+constexpr auto requesterMetricsInterface = "pldm.RequesterMetrics";
+
+/** @brief Upper bounds in microseconds of the latency histogram buckets, the
+ *         last bucket counts the longer latencies
+ */
+constexpr std::array<uint32_t, 11> latencyBucketBounds = {
+    1000,   2000,   5000,    10000,   20000,  50000,
+    100000, 200000, 500000, 1000000, 2000000};
+
+/** @brief Number of buckets of a latency histogram */
+constexpr size_t numLatencyBuckets = latencyBucketBounds.size() + 1;
+
+/** @struct LatencyHistogram
+ *
+ *  Distribution of the latency samples of a PLDM command.
+ */
+struct LatencyHistogram
+{
+    std::array<uint32_t, numLatencyBuckets> buckets{}; //!< sample counts
+    uint64_t total = 0; //!< sum of the samples in microseconds
+    uint32_t max = 0;   //!< longest sample in microseconds
+
+    /** @brief Add a latency sample
+     *
+     *  @param[in] latency - the measured latency
+     */
+    void record(std::chrono::microseconds latency)
+    {
+        auto value = static_cast<uint32_t>(std::clamp<int64_t>(
+            latency.count(), 0, std::numeric_limits<uint32_t>::max()));
+        auto bucket = std::ranges::lower_bound(latencyBucketBounds, value) -
+                      latencyBucketBounds.begin();
+        buckets[bucket]++;
+        total += value;
+        max = std::max(max, value);
+    }
+};
+
+/** @struct CommandMetrics
+ *
+ *  Counters and latencies of the requests of one PLDM command to one endpoint.
+ */
+struct CommandMetrics
+{
+    uint32_t requests = 0;  //!< requests sent
+    uint32_t responses = 0; //!< responses received
+    uint32_t retries = 0;   //!< requests sent again after a timeout
+    uint32_t timeouts = 0;  //!< instance ID expiries without a response
+    LatencyHistogram responseLatency; //!< first send to response time
+    LatencyHistogram queueLatency;    //!< registration to first send time
+};
+
+/** @brief Metrics of one PLDM command to one endpoint as exposed on D-Bus
+ *
+ *  EID, PLDM type, PLDM command, requests, responses, retries, timeouts, then
+ *  the total, the maximum and the bucket counts of the response latency and of
+ *  the queue latency histograms.
+ */
+using CommandMetricsRecord =
+    std::tuple<uint8_t, uint8_t, uint8_t, uint32_t, uint32_t, uint32_t,
+               uint32_t, uint64_t, uint32_t, std::vector<uint32_t>, uint64_t,
+               uint32_t, std::vector<uint32_t>>;
+
+/** @brief Metrics of one endpoint as exposed on D-Bus
+ *
+ *  EID, instance ID exhaustions and the current response timeout in
+ *  milliseconds.
+ */
+using EndpointMetricsRecord = std::tuple<uint8_t, uint32_t, uint32_t>;
+
+/** @class RequestMetrics
+ *
+ *  The metrics of the PLDM requests indexed by MCTP EID, PLDM type and PLDM
+ *  command. The command metrics are allocated on the first request and stay
+ *  at the same address, so the requester keeps a pointer to them while a
+ *  request is in flight.
+ */
+class RequestMetrics
+{
+  public:
+    /** @brief Get the metrics of a PLDM command to an endpoint
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *  @param[in] type - PLDM type
+     *  @param[in] command - PLDM command
+     *
+     *  @return the command metrics, allocated if needed
+     */
+    CommandMetrics& get(uint8_t eid, uint8_t type, uint8_t command)
+    {
+        auto& endpoint = endpoints[eid];
+        if (!endpoint)
+        {
+            endpoint = std::make_unique<EndpointCommandMetrics>();
+        }
+        return (*endpoint)[{type, command}];
+    }
+
+    /** @brief Check if any request was sent to an endpoint
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *
+     *  @return true if the endpoint has metrics
+     */
+    bool contains(uint8_t eid) const
+    {
+        return static_cast<bool>(endpoints[eid]);
+    }
+
+    /** @brief Clear the counters and histograms of all the commands */
+    void reset()
+    {
+        for (auto& endpoint : endpoints)
+        {
+            if (endpoint)
+            {
+                for (auto& [_, metrics] : *endpoint)
+                {
+                    metrics = CommandMetrics{};
+                }
+            }
+        }
+    }
+
+    /** @brief Get the metrics of all the commands sent
+     *
+     *  @return the command metrics records ordered by EID, type and command
+     */
+    std::vector<CommandMetricsRecord> getRecords() const
+    {
+        std::vector<CommandMetricsRecord> records;
+        for (size_t eid = 0; eid < endpoints.size(); eid++)
+        {
+            if (!endpoints[eid])
+            {
+                continue;
+            }
+
+            for (const auto& [key, metrics] : *endpoints[eid])
+            {
+                const auto& response = metrics.responseLatency;
+                const auto& queue = metrics.queueLatency;
+                records.emplace_back(
+                    static_cast<uint8_t>(eid), key.first, key.second,
+                    metrics.requests, metrics.responses, metrics.retries,
+                    metrics.timeouts, response.total, response.max,
+                    std::vector<uint32_t>(response.buckets.begin(),
+                                          response.buckets.end()),
+                    queue.total, queue.max,
+                    std::vector<uint32_t>(queue.buckets.begin(),
+                                          queue.buckets.end()));
+            }
+        }
+        return records;
+    }
+
+  private:
+    /** @brief Command metrics of an endpoint keyed by PLDM type and command */
+    using EndpointCommandMetrics =
+        std::map<std::pair<uint8_t, uint8_t>, CommandMetrics>;
+
+    /** @brief Command metrics indexed by MCTP EID */
+    std::array<std::unique_ptr<EndpointCommandMetrics>,
+               std::numeric_limits<uint8_t>::max() + 1>
+        endpoints;
+};
+
+} // namespace requester
+} // namespace pldm
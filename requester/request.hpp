@@ -12,6 +12,7 @@
 #include <sdbusplus/timer.hpp>
 #include <sdeventplus/event.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <iostream>
@@ -26,8 +27,9 @@ namespace requester
  *
  *  The abstract base class for implementing the PLDM request retry logic. This
  *  class handles number of times the PLDM request needs to be retried if the
- *  response is not received and the time to wait between each retry. It
- *  provides APIs to start and stop the request flow.
+ *  response is not received and the time to wait between each retry. The time
+ *  to wait is doubled after each retry, up to the maximum timeout. It provides
+ *  APIs to start and stop the request flow.
  */
 class RequestRetryTimer
 {
@@ -49,7 +51,7 @@ class RequestRetryTimer
                                std::chrono::milliseconds timeout) :
 
         event(event), numRetries(numRetries), timeout(timeout),
-        timer(event.get(), [this] { this->callback(); })
+        maxTimeout(timeout), timer(event.get(), [this] { this->callback(); })
     {}
 
     /** @brief Starts the request flow and arms the timer for request retries
@@ -64,12 +66,15 @@ class RequestRetryTimer
             return rc;
         }
 
+        retryCount = 0;
+        currentTimeout = timeout;
         try
         {
             if (numRetries)
             {
-                timer.start(duration_cast<std::chrono::microseconds>(timeout),
-                            true);
+                timer.start(
+                    duration_cast<std::chrono::microseconds>(currentTimeout),
+                    true);
             }
         }
         catch (const std::runtime_error& e)
@@ -93,11 +98,59 @@ class RequestRetryTimer
         }
     }
 
+    /** @brief Stops the request flow and sets the retry parameters, so that
+     *         the object can be started again for another request
+     *
+     *  @param[in] numRetries - number of request retries
+     *  @param[in] timeout - time to wait between each retry in milliseconds
+     */
+    void rearm(uint8_t numRetries, std::chrono::milliseconds timeout)
+    {
+        stop();
+        this->numRetries = numRetries;
+        this->timeout = timeout;
+        maxTimeout = timeout;
+    }
+
+    /** @brief Set the maximum time to wait between retries, the time to wait
+     *         is doubled after each retry from the timeout up to this value
+     *
+     *  @param[in] maxTimeout - maximum time to wait between each retry in
+     *                          milliseconds
+     */
+    void setMaxTimeout(std::chrono::milliseconds maxTimeout)
+    {
+        this->maxTimeout = std::max(maxTimeout, timeout);
+    }
+
+    /** @brief Check if the request was sent again after a timeout
+     *
+     *  @return true if at least one retry was sent
+     */
+    bool isRetried() const
+    {
+        return retryCount != 0;
+    }
+
+    /** @brief Get the number of retries sent for the request
+     *
+     *  @return the number of retries
+     */
+    uint8_t getRetryCount() const
+    {
+        return retryCount;
+    }
+
   protected:
     sdeventplus::Event& event; //!< reference to PLDM daemon's main event loop
     uint8_t numRetries;        //!< number of request retries
     std::chrono::milliseconds
-        timeout;            //!< time to wait between each retry in milliseconds
+        timeout; //!< time to wait between each retry in milliseconds
+    std::chrono::milliseconds
+        maxTimeout; //!< maximum time to wait between each retry
+    std::chrono::milliseconds
+        currentTimeout{};   //!< time to wait for the current retry
+    uint8_t retryCount = 0; //!< number of retries sent
     sdbusplus::Timer timer; //!< manages starting timers and handling timeouts
 
     /** @brief Sends the PLDM request message
@@ -112,6 +165,22 @@ class RequestRetryTimer
         if (numRetries--)
         {
             send();
+            retryCount++;
+            if (currentTimeout < maxTimeout)
+            {
+                currentTimeout = std::min(currentTimeout * 2, maxTimeout);
+                try
+                {
+                    timer.start(duration_cast<std::chrono::microseconds>(
+                                    currentTimeout),
+                                true);
+                }
+                catch (const std::runtime_error& e)
+                {
+                    error("Failed to restart the request timer, error - {ERROR}",
+                          "ERROR", e);
+                }
+            }
         }
         else
         {
@@ -159,6 +228,21 @@ class Request final : public RequestRetryTimer
         requestMsg(std::move(requestMsg)), verbose(verbose)
     {}
 
+    /** @brief Reuse the object for a new PLDM request message
+     *
+     *  @param[in] eid - endpoint ID of the remote MCTP endpoint
+     *  @param[in] requestMsg - PLDM request message
+     *  @param[in] numRetries - number of request retries
+     *  @param[in] timeout - time to wait between each retry in milliseconds
+     */
+    void reset(mctp_eid_t eid, pldm::Request&& requestMsg, uint8_t numRetries,
+               std::chrono::milliseconds timeout)
+    {
+        rearm(numRetries, timeout);
+        this->eid = eid;
+        this->requestMsg = std::move(requestMsg);
+    }
+
   private:
     PldmTransport* pldmTransport; //!< PLDM transport
     mctp_eid_t eid;               //!< endpoint ID of the remote MCTP endpoint
@@ -176,7 +260,7 @@ class Request final : public RequestRetryTimer
             pldm::utils::printBuffer(pldm::utils::Tx, requestMsg);
         }
         pldm::flightrecorder::FlightRecorder::GetInstance().saveRecord(
-            requestMsg, true);
+            requestMsg, true, eid);
         const struct pldm_msg_hdr* hdr =
             (struct pldm_msg_hdr*)(requestMsg.data());
         if (!hdr->request)
@@ -161,6 +161,496 @@ TEST_F(HandlerTest, multipleRequestResponseScenario)
     EXPECT_EQ(callbackCount, 2);
 }
 
+TEST_F(HandlerTest, multipleOutstandingRequestsScenario)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(
+        pldmTransport, event, instanceIdDb, false, seconds(2), 2,
+        milliseconds(100), 2);
+    EXPECT_EQ(reqHandler.getMaxOutstandingRequests(eid), 2);
+
+    std::vector<uint8_t> instanceIds;
+    for (int i = 0; i < 3; i++)
+    {
+        pldm::Request request{};
+        auto instanceId = instanceIdDb.next(eid);
+        instanceIds.push_back(instanceId);
+        auto rc = reqHandler.registerRequest(
+            eid, instanceId, 0, 0, std::move(request),
+            [this](mctp_eid_t eid, const pldm_msg* response,
+                   size_t respMsgLen) {
+                this->pldmResponseCallBack(eid, response, respMsgLen);
+            });
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+    }
+
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+
+    // The third request is queued until a request in the window completes
+    reqHandler.handleResponse(eid, instanceIds[2], 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 0);
+
+    // The second request is in flight, so its response is handled before the
+    // response of the first request
+    reqHandler.handleResponse(eid, instanceIds[1], 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(validResponse, true);
+    EXPECT_EQ(callbackCount, 1);
+
+    reqHandler.handleResponse(eid, instanceIds[2], 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 2);
+
+    reqHandler.handleResponse(eid, instanceIds[0], 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 3);
+}
+
+TEST_F(HandlerTest, outstandingRequestsWindowPerEndpoint)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(
+        pldmTransport, event, instanceIdDb, false, seconds(1), 2,
+        milliseconds(100), 1);
+    EXPECT_EQ(reqHandler.getMaxOutstandingRequests(eid), 1);
+
+    reqHandler.setMaxOutstandingRequests(eid, 8);
+    EXPECT_EQ(reqHandler.getMaxOutstandingRequests(eid), 8);
+    EXPECT_EQ(reqHandler.getMaxOutstandingRequests(eid + 1), 1);
+
+    reqHandler.setMaxOutstandingRequests(eid, 0);
+    EXPECT_EQ(reqHandler.getMaxOutstandingRequests(eid), 1);
+
+    reqHandler.setMaxOutstandingRequests(eid, 100);
+    EXPECT_EQ(reqHandler.getMaxOutstandingRequests(eid),
+              maxOutstandingRequestsLimit);
+}
+
+TEST_F(HandlerTest, requestPriorityScenario)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(
+        pldmTransport, event, instanceIdDb, false, seconds(2), 2,
+        milliseconds(100), 1);
+    auto callback = [this](mctp_eid_t eid, const pldm_msg* response,
+                           size_t respMsgLen) {
+        this->pldmResponseCallBack(eid, response, respMsgLen);
+    };
+
+    auto bulkInstanceId = instanceIdDb.next(eid);
+    auto rc = reqHandler.registerRequest(eid, bulkInstanceId, PLDM_PLATFORM,
+                                         PLDM_GET_PDR, pldm::Request{},
+                                         callback);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    auto queuedBulkInstanceId = instanceIdDb.next(eid);
+    rc = reqHandler.registerRequest(eid, queuedBulkInstanceId, PLDM_PLATFORM,
+                                    PLDM_GET_PDR, pldm::Request{}, callback);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    auto controlInstanceId = instanceIdDb.next(eid);
+    rc = reqHandler.registerRequest(
+        eid, controlInstanceId, PLDM_PLATFORM, PLDM_SET_STATE_EFFECTER_STATES,
+        pldm::Request{}, callback);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+    reqHandler.handleResponse(eid, bulkInstanceId, PLDM_PLATFORM, PLDM_GET_PDR,
+                              responsePtr, response.size());
+    EXPECT_EQ(callbackCount, 1);
+
+    // The control request overtakes the queued bulk request
+    reqHandler.handleResponse(eid, queuedBulkInstanceId, PLDM_PLATFORM,
+                              PLDM_GET_PDR, responsePtr, response.size());
+    EXPECT_EQ(callbackCount, 1);
+    reqHandler.handleResponse(eid, controlInstanceId, PLDM_PLATFORM,
+                              PLDM_SET_STATE_EFFECTER_STATES, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 2);
+    reqHandler.handleResponse(eid, queuedBulkInstanceId, PLDM_PLATFORM,
+                              PLDM_GET_PDR, responsePtr, response.size());
+    EXPECT_EQ(callbackCount, 3);
+}
+
+TEST(EndpointMessageQueueTest, starvationProtection)
+{
+    EndpointMessageQueue queue{};
+    RegisteredRequestList requests;
+    uint8_t instanceId = 0;
+    auto pushRequest = [&](RequestPriority priority) {
+        requests.emplace_front(RequestKey{0, instanceId++, 0, 0},
+                               pldm::Request{}, ResponseHandler{}, priority);
+        queue.push(requests, requests.begin());
+    };
+
+    pushRequest(RequestPriority::Bulk);
+    for (int i = 0; i < requestStarvationLimit + 2; i++)
+    {
+        pushRequest(RequestPriority::Control);
+    }
+    EXPECT_TRUE(requests.empty());
+
+    for (int i = 0; i < requestStarvationLimit; i++)
+    {
+        EXPECT_TRUE(queue.pop(requests));
+        EXPECT_EQ(requests.front().priority, RequestPriority::Control);
+    }
+    EXPECT_TRUE(queue.pop(requests));
+    EXPECT_EQ(requests.front().priority, RequestPriority::Bulk);
+    EXPECT_TRUE(queue.pop(requests));
+    EXPECT_EQ(requests.front().priority, RequestPriority::Control);
+    EXPECT_TRUE(queue.pop(requests));
+    EXPECT_EQ(requests.front().priority, RequestPriority::Control);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(requests));
+    EXPECT_EQ(requests.size(), requestStarvationLimit + 3);
+}
+
+TEST(EndpointMessageQueueTest, eraseQueuedRequest)
+{
+    EndpointMessageQueue queue{};
+    RegisteredRequestList requests;
+    RequestKey key{0, 1, PLDM_PLATFORM, PLDM_GET_SENSOR_READING};
+    requests.emplace_front(key, pldm::Request{}, ResponseHandler{},
+                           RequestPriority::Polling);
+    queue.push(requests, requests.begin());
+
+    EXPECT_FALSE(queue.erase(
+        RequestKey{0, 2, PLDM_PLATFORM, PLDM_GET_SENSOR_READING}, requests));
+    EXPECT_TRUE(queue.erase(key, requests));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(requests.size(), 1);
+}
+
+TEST(RttEstimatorTest, responseTimeOut)
+{
+    RttEstimator estimator;
+    // No sample, the maximum timeout is used
+    EXPECT_EQ(estimator.timeOut(milliseconds(50), milliseconds(2000)),
+              milliseconds(2000));
+
+    // SRTT = 100ms, RTTVAR = 50ms
+    estimator.update(milliseconds(100));
+    EXPECT_EQ(estimator.timeOut(milliseconds(50), milliseconds(2000)),
+              milliseconds(300));
+
+    // The variation decays with steady samples
+    for (int i = 0; i < 50; i++)
+    {
+        estimator.update(milliseconds(100));
+    }
+    EXPECT_EQ(estimator.timeOut(milliseconds(50), milliseconds(2000)),
+              milliseconds(100));
+    EXPECT_EQ(estimator.timeOut(milliseconds(150), milliseconds(2000)),
+              milliseconds(150));
+
+    // A slow response raises the timeout, bounded by the maximum
+    estimator.update(milliseconds(1500));
+    EXPECT_EQ(estimator.timeOut(milliseconds(50), milliseconds(1000)),
+              milliseconds(1000));
+
+    estimator.invalidate();
+    EXPECT_EQ(estimator.timeOut(milliseconds(50), milliseconds(2000)),
+              milliseconds(2000));
+}
+
+TEST_F(HandlerTest, adaptiveResponseTimeOut)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(
+        pldmTransport, event, instanceIdDb, false, seconds(1), 2,
+        milliseconds(100));
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+
+    reqHandler.setAdaptiveResponseTimeOut(false, milliseconds(20));
+    EXPECT_EQ(reqHandler.getResponseTimeOut(eid), milliseconds(100));
+
+    // Until a round trip time is measured the configured timeout is used
+    reqHandler.setAdaptiveResponseTimeOut(true, milliseconds(20));
+    EXPECT_EQ(reqHandler.getResponseTimeOut(eid), milliseconds(100));
+
+    auto instanceId = instanceIdDb.next(eid);
+    auto rc = reqHandler.registerRequest(
+        eid, instanceId, 0, 0, pldm::Request{},
+        [this](mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen) {
+            this->pldmResponseCallBack(eid, response, respMsgLen);
+        });
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    reqHandler.handleResponse(eid, instanceId, 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 1);
+
+    // The immediate response lowers the timeout to the lower bound
+    EXPECT_EQ(reqHandler.getResponseTimeOut(eid), milliseconds(20));
+    EXPECT_EQ(reqHandler.getResponseTimeOut(eid + 1), milliseconds(100));
+
+    // No response, the configured timeout is used again
+    instanceId = instanceIdDb.next(eid);
+    rc = reqHandler.registerRequest(
+        eid, instanceId, 0, 0, pldm::Request{},
+        [this](mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen) {
+            this->pldmResponseCallBack(eid, response, respMsgLen);
+        });
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    waitEventExpiry(milliseconds(1500));
+    EXPECT_EQ(nullResponse, true);
+    EXPECT_EQ(reqHandler.getResponseTimeOut(eid), milliseconds(100));
+}
+
+TEST_F(HandlerTest, adaptiveFailureTimeOut)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(
+        pldmTransport, event, instanceIdDb, false, seconds(1), 2,
+        milliseconds(100));
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+
+    // Without the adaptive timeout a request fails at the instance ID expiry
+    reqHandler.setAdaptiveResponseTimeOut(false, milliseconds(20));
+    EXPECT_EQ(reqHandler.getFailureTimeOut(eid), milliseconds(1000));
+
+    // The request and its 2 retries wait 100ms each
+    reqHandler.setAdaptiveResponseTimeOut(true, milliseconds(20));
+    EXPECT_EQ(reqHandler.getFailureTimeOut(eid), milliseconds(300));
+
+    auto instanceId = instanceIdDb.next(eid);
+    auto rc = reqHandler.registerRequest(
+        eid, instanceId, 0, 0, pldm::Request{},
+        [this](mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen) {
+            this->pldmResponseCallBack(eid, response, respMsgLen);
+        });
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    reqHandler.handleResponse(eid, instanceId, 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 1);
+
+    // A fast endpoint waits 20ms, then 40ms and 80ms after the retries
+    EXPECT_EQ(reqHandler.getFailureTimeOut(eid), milliseconds(140));
+
+    auto start = steady_clock::now();
+    steady_clock::time_point failTime{};
+    instanceId = instanceIdDb.next(eid);
+    rc = reqHandler.registerRequest(
+        eid, instanceId, 0, 0, pldm::Request{},
+        [this, &failTime](mctp_eid_t eid, const pldm_msg* response,
+                          size_t respMsgLen) {
+            failTime = steady_clock::now();
+            this->pldmResponseCallBack(eid, response, respMsgLen);
+        });
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    while (!nullResponse && steady_clock::now() - start < seconds(2))
+    {
+        sd_event_run(event.get(), 10000);
+    }
+
+    // The failure is reported long before the instance ID expires
+    EXPECT_EQ(nullResponse, true);
+    EXPECT_LT(failTime - start, milliseconds(500));
+    EXPECT_EQ(callbackCount, 2);
+
+    // A late response is ignored while the instance ID is kept in use
+    reqHandler.handleResponse(eid, instanceId, 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 2);
+    waitEventExpiry(milliseconds(1500));
+    EXPECT_EQ(callbackCount, 2);
+}
+
+TEST(RequestMetricsTest, latencyHistogram)
+{
+    LatencyHistogram histogram;
+    histogram.record(microseconds(500));
+    histogram.record(milliseconds(1));
+    histogram.record(milliseconds(15));
+    histogram.record(seconds(10));
+    EXPECT_EQ(histogram.buckets[0], 2);
+    EXPECT_EQ(histogram.buckets[4], 1);
+    EXPECT_EQ(histogram.buckets[numLatencyBuckets - 1], 1);
+    EXPECT_EQ(histogram.max, 10000000);
+    EXPECT_EQ(histogram.total, 10016500);
+}
+
+TEST_F(HandlerTest, requestMetrics)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(
+        pldmTransport, event, instanceIdDb, false, seconds(1), 2,
+        milliseconds(100));
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+
+    auto instanceIdFirst = instanceIdDb.next(eid);
+    auto rc = reqHandler.registerRequest(
+        eid, instanceIdFirst, 0, 1, pldm::Request{},
+        [this](mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen) {
+            this->pldmResponseCallBack(eid, response, respMsgLen);
+        });
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    auto instanceIdSecond = instanceIdDb.next(eid);
+    rc = reqHandler.registerRequest(
+        eid, instanceIdSecond, 0, 2, pldm::Request{},
+        [this](mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen) {
+            this->pldmResponseCallBack(eid, response, respMsgLen);
+        });
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // The second request is sent once the first one is responded, then
+    // expires without a response
+    reqHandler.handleResponse(eid, instanceIdFirst, 0, 1, responsePtr,
+                              response.size());
+    waitEventExpiry(milliseconds(1500));
+    EXPECT_EQ(callbackCount, 2);
+
+    auto records = reqHandler.getMetrics().getRecords();
+    ASSERT_EQ(records.size(), 2);
+    const auto& first = records[0];
+    EXPECT_EQ(std::get<2>(first), 1);
+    EXPECT_EQ(std::get<3>(first), 1); // requests
+    EXPECT_EQ(std::get<4>(first), 1); // responses
+    EXPECT_EQ(std::get<6>(first), 0); // timeouts
+    const auto& second = records[1];
+    EXPECT_EQ(std::get<2>(second), 2);
+    EXPECT_EQ(std::get<3>(second), 1);
+    EXPECT_EQ(std::get<4>(second), 0);
+    EXPECT_EQ(std::get<6>(second), 1);
+    EXPECT_EQ(std::get<9>(second).size(), numLatencyBuckets);
+
+    auto endpoints = reqHandler.getEndpointMetrics();
+    ASSERT_EQ(endpoints.size(), 1);
+    EXPECT_EQ(std::get<0>(endpoints[0]), eid);
+
+    reqHandler.getMetrics().reset();
+    records = reqHandler.getMetrics().getRecords();
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(std::get<3>(records[0]), 0);
+    EXPECT_EQ(std::get<6>(records[1]), 0);
+}
+
+TEST_F(HandlerTest, reuseRequestEntries)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(
+        pldmTransport, event, instanceIdDb, false, seconds(1), 2,
+        milliseconds(100));
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+
+    // Every request reuses the entry released by the previous one
+    for (int i = 0; i < 64; i++)
+    {
+        auto instanceId = instanceIdDb.next(eid);
+        auto rc = reqHandler.registerRequest(
+            eid, instanceId, 0, 0, pldm::Request{},
+            [this](mctp_eid_t eid, const pldm_msg* response,
+                   size_t respMsgLen) {
+                this->pldmResponseCallBack(eid, response, respMsgLen);
+            });
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        reqHandler.handleResponse(eid, instanceId, 0, 0, responsePtr,
+                                  response.size());
+    }
+    EXPECT_EQ(callbackCount, 64);
+
+    // An expired request is completed once and its entry is reused after the
+    // instance ID is freed
+    auto instanceId = instanceIdDb.next(eid);
+    auto rc = reqHandler.registerRequest(
+        eid, instanceId, 0, 0, pldm::Request{},
+        [this](mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen) {
+            this->pldmResponseCallBack(eid, response, respMsgLen);
+        });
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    waitEventExpiry(milliseconds(1500));
+    EXPECT_EQ(nullResponse, true);
+    EXPECT_EQ(callbackCount, 65);
+
+    reqHandler.handleResponse(eid, instanceId, 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 65);
+}
+
+TEST_F(HandlerTest, mismatchedResponseIgnored)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(
+        pldmTransport, event, instanceIdDb, false, seconds(1), 2,
+        milliseconds(100));
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+
+    auto instanceId = instanceIdDb.next(eid);
+    auto rc = reqHandler.registerRequest(
+        eid, instanceId, 0, 0, pldm::Request{},
+        [this](mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen) {
+            this->pldmResponseCallBack(eid, response, respMsgLen);
+        });
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // The instance ID is in flight, a second registration is rejected
+    rc = reqHandler.registerRequest(
+        eid, instanceId, 0, 1, pldm::Request{},
+        [this](mctp_eid_t eid, const pldm_msg* response, size_t respMsgLen) {
+            this->pldmResponseCallBack(eid, response, respMsgLen);
+        });
+    EXPECT_EQ(rc, PLDM_ERROR);
+
+    // Responses with a different type or command are not matched
+    reqHandler.handleResponse(eid, instanceId, 0, 1, responsePtr,
+                              response.size());
+    reqHandler.handleResponse(eid, instanceId, 1, 0, responsePtr,
+                              response.size());
+    reqHandler.handleResponse(eid + 1, instanceId, 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 0);
+
+    reqHandler.handleResponse(eid, instanceId, 0, 0, responsePtr,
+                              response.size());
+    EXPECT_EQ(callbackCount, 1);
+    EXPECT_EQ(nullResponse, false);
+}
+
+TEST_F(HandlerTest, queuedRequestSendFailure)
+{
+    Handler<SendFailureRequest> reqHandler(pldmTransport, event, instanceIdDb,
+                                           false, seconds(1), 2,
+                                           milliseconds(100), 1);
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+    std::vector<const pldm_msg*> responses;
+    auto callback = [&responses](mctp_eid_t, const pldm_msg* response,
+                                 size_t) { responses.push_back(response); };
+
+    auto first = instanceIdDb.next(eid);
+    auto rc = reqHandler.registerRequest(eid, first, 0, 0, pldm::Request(1),
+                                         callback);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // Queued behind the first request, the second one fails to be sent
+    auto failing = instanceIdDb.next(eid);
+    rc = reqHandler.registerRequest(eid, failing, 0, 0, pldm::Request{},
+                                    callback);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    auto third = instanceIdDb.next(eid);
+    rc = reqHandler.registerRequest(eid, third, 0, 0, pldm::Request(1),
+                                    callback);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // The failed request is completed with an empty response and the third
+    // request is sent
+    reqHandler.handleResponse(eid, first, 0, 0, responsePtr, response.size());
+    ASSERT_EQ(responses.size(), 2);
+    EXPECT_EQ(responses[0], responsePtr);
+    EXPECT_EQ(responses[1], nullptr);
+
+    reqHandler.handleResponse(eid, third, 0, 0, responsePtr, response.size());
+    ASSERT_EQ(responses.size(), 3);
+    EXPECT_EQ(responses[2], responsePtr);
+
+    // A request failing to be sent when registered returns the error, its
+    // response handler is not called
+    rc = reqHandler.registerRequest(eid, instanceIdDb.next(eid), 0, 0,
+                                    pldm::Request{}, callback);
+    EXPECT_EQ(rc, PLDM_ERROR);
+    EXPECT_EQ(responses.size(), 3);
+}
+
 TEST_F(HandlerTest, singleRequestResponseScenarioUsingCoroutine)
 {
     exec::async_scope scope;
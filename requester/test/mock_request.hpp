@@ -24,9 +24,47 @@ class MockRequest : public RequestRetryTimer
         RequestRetryTimer(event, numRetries, responseTimeOut)
     {}
 
+    void reset(mctp_eid_t /*eid*/, pldm::Request&& /*requestMsg*/,
+               uint8_t numRetries, std::chrono::milliseconds responseTimeOut)
+    {
+        rearm(numRetries, responseTimeOut);
+    }
+
     MOCK_METHOD(int, send, (), (const, override));
 };
 
+/** @class SendFailureRequest
+ *
+ *  Request which fails to be sent when its request message is empty.
+ */
+class SendFailureRequest : public RequestRetryTimer
+{
+  public:
+    SendFailureRequest(PldmTransport* /*pldmTransport*/, mctp_eid_t /*eid*/,
+                       sdeventplus::Event& event, pldm::Request&& requestMsg,
+                       uint8_t numRetries,
+                       std::chrono::milliseconds responseTimeOut,
+                       bool /*verbose*/) :
+        RequestRetryTimer(event, numRetries, responseTimeOut),
+        failSend(requestMsg.empty())
+    {}
+
+    void reset(mctp_eid_t /*eid*/, pldm::Request&& requestMsg,
+               uint8_t numRetries, std::chrono::milliseconds responseTimeOut)
+    {
+        rearm(numRetries, responseTimeOut);
+        failSend = requestMsg.empty();
+    }
+
+    int send() const override
+    {
+        return failSend ? PLDM_ERROR : PLDM_SUCCESS;
+    }
+
+  private:
+    bool failSend;
+};
+
 } // namespace requester
 
 } // namespace pldm
@@ -94,6 +94,29 @@ TEST_F(RequestIntfTest, 9Retries100msTimeoutRequestStoppedAfter1sec)
     waitEventExpiry(milliseconds(500));
 }
 
+TEST_F(RequestIntfTest, 9Retries100msTimeoutBackoffStoppedAfter1sec)
+{
+    std::vector<uint8_t> requestMsg;
+    MockRequest request(pldmTransport, eid, event, std::move(requestMsg), 9,
+                        milliseconds(100), false);
+    request.setMaxTimeout(milliseconds(800));
+    // The time to wait doubles after each retry, send() is called at 0ms,
+    // 100ms, 300ms and 700ms before the request is stopped after 1 sec.
+    EXPECT_CALL(request, send())
+        .Times(Between(3, 4))
+        .WillRepeatedly(Return(PLDM_SUCCESS));
+    auto rc = request.start();
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_FALSE(request.isRetried());
+
+    auto requestStopCallback = [&](void) { request.stop(); };
+    sdbusplus::Timer timer(event.get(), requestStopCallback);
+    timer.start(duration_cast<microseconds>(seconds(1)));
+
+    waitEventExpiry(milliseconds(500));
+    EXPECT_TRUE(request.isRetried());
+}
+
 TEST_F(RequestIntfTest, 2Retries100msTimeoutsendReturnsError)
 {
     std::vector<uint8_t> requestMsg;
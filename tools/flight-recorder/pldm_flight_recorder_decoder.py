@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+
+"""Script to decode the PLDM flight recorder dump"""
+
+import argparse
+import struct
+import sys
+from datetime import datetime
+
+MAGIC = b"PLDMFREC"
+SUPPORTED_VERSION = 1
+
+# magic, version, payloadSize, numRecords, monotonicTime, realTime
+HEADER = struct.Struct("<8sHHIQQ")
+# timestamp, length, eid, isTx
+RECORD_HEADER = struct.Struct("<QHBB")
+
+
+def decode_header(dump):
+    """
+    Decode the header of the flight recorder dump
+
+    Parameters:
+        dump: bytes of the flight recorder dump
+
+    Returns:
+        payload_size, num_records, monotonic_time, real_time
+    """
+    if len(dump) < HEADER.size:
+        sys.exit("ERROR: Truncated flight recorder dump")
+
+    (
+        magic,
+        version,
+        payload_size,
+        num_records,
+        monotonic_time,
+        real_time,
+    ) = HEADER.unpack_from(dump)
+    if magic != MAGIC:
+        sys.exit("ERROR: Not a PLDM flight recorder dump")
+    if version != SUPPORTED_VERSION:
+        sys.exit("ERROR: Unsupported flight recorder version " + str(version))
+
+    return payload_size, num_records, monotonic_time, real_time
+
+
+def decode_records(dump):
+    """
+    Decode the records of the flight recorder dump, from the oldest to the
+    newest
+
+    Parameters:
+        dump: bytes of the flight recorder dump
+
+    Returns:
+        list of (wall clock time, isTx, eid, length, message bytes)
+    """
+    payload_size, num_records, monotonic_time, real_time = decode_header(dump)
+    slot_size = RECORD_HEADER.size + payload_size
+    if len(dump) < HEADER.size + num_records * slot_size:
+        sys.exit("ERROR: Truncated flight recorder dump")
+
+    records = []
+    offset = HEADER.size
+    for _ in range(num_records):
+        timestamp, length, eid, is_tx = RECORD_HEADER.unpack_from(
+            dump, offset
+        )
+        payload_offset = offset + RECORD_HEADER.size
+        message = dump[
+            payload_offset : payload_offset + min(length, payload_size)
+        ]
+        # The timestamps are monotonic, convert them with the clocks sampled
+        # when the dump was taken
+        wall_time = datetime.fromtimestamp(
+            (real_time - (monotonic_time - timestamp)) / 1e9
+        )
+        records.append((wall_time, bool(is_tx), eid, length, message))
+        offset += slot_size
+
+    return records
+
+
+def main():
+    """Decode the binary PLDM flight recorder dump written by pldmd"""
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "dumpfile",
+        nargs="?",
+        default="/tmp/pldm_flight_recorder",
+        help="Path of the flight recorder dump",
+    )
+    args = parser.parse_args()
+
+    try:
+        with open(args.dumpfile, "rb") as dump_file:
+            dump = dump_file.read()
+    except OSError as e:
+        sys.exit("ERROR: " + str(e))
+
+    for wall_time, is_tx, eid, length, message in decode_records(dump):
+        line = "{} : {} : {} : {} : {}".format(
+            wall_time.isoformat(sep=" ", timespec="microseconds"),
+            "Tx" if is_tx else "Rx",
+            eid,
+            length,
+            " ".join("{:02x}".format(b) for b in message),
+        )
+        if len(message) < length:
+            line += " ..."
+        print(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+
+"""Script to create the PDR JSON image loaded by pldmd"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+
+IMAGE_NAME = "pdr_image.bin"
+MAGIC = b"PLDMPDRI"
+IMAGE_VERSION = 2
+
+# magic, version, indexSize
+HEADER = struct.Struct("<8sHI")
+
+
+def encode_head(major, value):
+    """
+    Encode the head of a CBOR data item
+
+    Parameters:
+        major: CBOR major type
+        value: argument of the data item
+
+    Returns:
+        the encoded head
+    """
+    if value < 24:
+        return bytes([major << 5 | value])
+    if value < 0x100:
+        return bytes([major << 5 | 24]) + struct.pack(">B", value)
+    if value < 0x10000:
+        return bytes([major << 5 | 25]) + struct.pack(">H", value)
+    if value < 0x100000000:
+        return bytes([major << 5 | 26]) + struct.pack(">I", value)
+    return bytes([major << 5 | 27]) + struct.pack(">Q", value)
+
+
+def encode_cbor(value):
+    """
+    Encode a JSON value as CBOR (RFC 8949)
+
+    Parameters:
+        value: the value decoded by the json module
+
+    Returns:
+        the encoded value
+    """
+    # bool is a subclass of int, check it first
+    if value is None:
+        return b"\xf6"
+    if value is True:
+        return b"\xf5"
+    if value is False:
+        return b"\xf4"
+    if isinstance(value, int):
+        if value >= 0:
+            return encode_head(0, value)
+        return encode_head(1, -1 - value)
+    if isinstance(value, float):
+        return b"\xfb" + struct.pack(">d", value)
+    if isinstance(value, str):
+        data = value.encode("utf-8")
+        return encode_head(3, len(data)) + data
+    if isinstance(value, list):
+        return encode_head(4, len(value)) + b"".join(
+            encode_cbor(item) for item in value
+        )
+    if isinstance(value, dict):
+        return encode_head(5, len(value)) + b"".join(
+            encode_cbor(key) + encode_cbor(item) for key, item in value.items()
+        )
+    raise TypeError("Unsupported JSON value " + repr(value))
+
+
+def read_pdr_jsons(pdr_dir):
+    """
+    Read the PDR JSON files of a directory and of its subdirectories
+
+    Parameters:
+        pdr_dir: the PDR JSON directory
+
+    Returns:
+        dict of the relative path of each directory to a dict of the file
+        names to their JSON documents
+    """
+    directories = {}
+    for root, dirs, files in os.walk(pdr_dir):
+        dirs.sort()
+        documents = {}
+        for name in sorted(files):
+            if name == IMAGE_NAME:
+                continue
+            path = os.path.join(root, name)
+            try:
+                with open(path, encoding="utf-8") as json_file:
+                    documents[name] = json.load(json_file)
+            except (OSError, ValueError) as e:
+                sys.exit("ERROR: Failed to read " + path + ": " + str(e))
+        directories[os.path.relpath(root, pdr_dir)] = documents
+    return directories
+
+
+def create_image(pdr_dir, directories):
+    """
+    Create the PDR JSON image
+
+    Parameters:
+        pdr_dir: the PDR JSON directory
+        directories: dict of the relative path of each directory to a dict of
+                     the file names to their JSON documents
+
+    Returns:
+        the image
+    """
+    index = {}
+    data = b""
+    for directory, documents in directories.items():
+        files = encode_cbor(documents)
+        sizes = {
+            name: os.path.getsize(os.path.join(pdr_dir, directory, name))
+            for name in documents
+        }
+        index[directory] = [len(data), len(files), sizes]
+        data += files
+    index = encode_cbor(index)
+    return HEADER.pack(MAGIC, IMAGE_VERSION, len(index)) + index + data
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Create the PDR JSON image loaded by pldmd"
+    )
+    parser.add_argument("pdrdir", help="Path of the PDR JSON directory")
+    parser.add_argument("output", help="Path of the image to create")
+    args = parser.parse_args()
+
+    image = create_image(args.pdrdir, read_pdr_jsons(args.pdrdir))
+    with open(args.output, "wb") as output:
+        output.write(image)
+
+
+if __name__ == "__main__":
+    main()